@@ -0,0 +1,92 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+// Replaces the global operator new and delete to count the heap traffic of each benchmark, reported by Google
+// Benchmark as allocs_per_iter and max_bytes_used next to the timings.
+// Every block starts with a header recording its size, so that delete knows how much memory it gives back.
+// The header fills a whole alignment unit, so the memory returned after it keeps the requested alignment.
+namespace {
+
+    constexpr size_t default_alignment = alignof(std::max_align_t);
+
+    bool tracking = false;
+    int64_t allocations = 0;
+    int64_t current_bytes = 0;
+    int64_t peak_bytes = 0;
+    int64_t total_bytes = 0;
+
+    class AllocationCounter : public benchmark::MemoryManager {
+    public:
+        void Start() override {
+            allocations = current_bytes = peak_bytes = total_bytes = 0;
+            tracking = true;
+        }
+
+        void Stop(Result &result) override {
+            tracking = false;
+            result.num_allocs = allocations;
+            result.max_bytes_used = peak_bytes;
+            result.total_allocated_bytes = total_bytes;
+            result.net_heap_growth = current_bytes;
+        }
+    };
+
+    AllocationCounter counter;
+    const bool registered = (benchmark::RegisterMemoryManager(&counter), true);
+
+    void *allocate(size_t size, size_t alignment) {
+        const size_t header_size = alignment < default_alignment ? default_alignment : alignment;
+        const size_t total = (header_size + size + alignment - 1) / alignment * alignment;
+        void *block = alignment <= default_alignment ? std::malloc(total) : std::aligned_alloc(alignment, total);
+        if (block == nullptr)
+            throw std::bad_alloc();
+
+        auto *pointer = static_cast<unsigned char *>(block) + header_size;
+        reinterpret_cast<size_t *>(pointer)[-1] = size;
+        if (tracking) {
+            ++allocations;
+            total_bytes += static_cast<int64_t>(size);
+            current_bytes += static_cast<int64_t>(size);
+            if (current_bytes > peak_bytes)
+                peak_bytes = current_bytes;
+        }
+        return pointer;
+    }
+
+    void deallocate(void *pointer, size_t alignment) noexcept {
+        if (pointer == nullptr)
+            return;
+
+        const size_t header_size = alignment < default_alignment ? default_alignment : alignment;
+        if (tracking)
+            current_bytes -= static_cast<int64_t>(reinterpret_cast<size_t *>(pointer)[-1]);
+        std::free(static_cast<unsigned char *>(pointer) - header_size);
+    }
+
+} // namespace
+
+void *operator new(size_t size) {
+    return allocate(size, default_alignment);
+}
+
+void *operator new(size_t size, std::align_val_t alignment) {
+    return allocate(size, static_cast<size_t>(alignment));
+}
+
+void operator delete(void *pointer) noexcept {
+    deallocate(pointer, default_alignment);
+}
+
+void operator delete(void *pointer, size_t) noexcept {
+    deallocate(pointer, default_alignment);
+}
+
+void operator delete(void *pointer, std::align_val_t alignment) noexcept {
+    deallocate(pointer, static_cast<size_t>(alignment));
+}
+
+void operator delete(void *pointer, size_t, std::align_val_t alignment) noexcept {
+    deallocate(pointer, static_cast<size_t>(alignment));
+}
@@ -0,0 +1,72 @@
+#include <memory_resource>
+
+#include "../DataStructure/LinkedList.h"
+#include "../DataStructure/List.h"
+#include "../DataStructure/MemoryResource.h"
+#include "BenchmarkSupport.h"
+
+// Request-scoped containers: built, used once and dropped, from the default heap or from an arena or pool freed at
+// the end of every iteration.
+static void BM_ListDefaultHeap(benchmark::State &state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    for (auto _: state) {
+        List<int> list;
+        for (size_t i = 0; i < count; ++i)
+            list.push_back(make_value<int>(i));
+        benchmark::DoNotOptimize(list.data());
+    }
+    set_throughput<int>(state, count);
+}
+
+static void BM_ListMonotonicArena(benchmark::State &state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    for (auto _: state) {
+        MonotonicArena arena;
+        List<int, std::pmr::polymorphic_allocator<int>> list(&arena);
+        for (size_t i = 0; i < count; ++i)
+            list.push_back(make_value<int>(i));
+        benchmark::DoNotOptimize(list.data());
+    }
+    set_throughput<int>(state, count);
+}
+
+static void BM_LinkedListDefaultHeap(benchmark::State &state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    for (auto _: state) {
+        LinkedList<int> list;
+        for (size_t i = 0; i < count; ++i)
+            list.push_front(make_value<int>(i));
+        benchmark::DoNotOptimize(list.front());
+    }
+    set_throughput<int>(state, count);
+}
+
+static void BM_LinkedListPool(benchmark::State &state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    for (auto _: state) {
+        PoolResource pool(16, 256);
+        LinkedList<int, std::pmr::polymorphic_allocator<int>> list(&pool);
+        for (size_t i = 0; i < count; ++i)
+            list.push_front(make_value<int>(i));
+        benchmark::DoNotOptimize(list.front());
+    }
+    set_throughput<int>(state, count);
+}
+
+static void BM_LinkedListMonotonicArena(benchmark::State &state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    for (auto _: state) {
+        MonotonicArena arena;
+        LinkedList<int, std::pmr::polymorphic_allocator<int>> list(&arena);
+        for (size_t i = 0; i < count; ++i)
+            list.push_front(make_value<int>(i));
+        benchmark::DoNotOptimize(list.front());
+    }
+    set_throughput<int>(state, count);
+}
+
+BENCHMARK(BM_ListDefaultHeap)->Apply(element_counts<int>);
+BENCHMARK(BM_ListMonotonicArena)->Apply(element_counts<int>);
+BENCHMARK(BM_LinkedListDefaultHeap)->Apply(element_counts<int>);
+BENCHMARK(BM_LinkedListPool)->Apply(element_counts<int>);
+BENCHMARK(BM_LinkedListMonotonicArena)->Apply(element_counts<int>);
@@ -0,0 +1,46 @@
+#include <array>
+#include <memory>
+
+#include "../DataStructure/Array.h"
+#include "BenchmarkSupport.h"
+
+// The sizes are template arguments here, and the arrays live on the heap so that the large ones fit.
+template<typename Container, typename Type, size_t count>
+static void BM_FillAndSum(benchmark::State &state) {
+    auto container = std::make_unique<Container>();
+    for (auto _: state) {
+        for (size_t i = 0; i < count; ++i)
+            (*container)[i] = make_value<Type>(i);
+
+        uint64_t total = 0;
+        for (const Type &value: *container)
+            total += key_of(value);
+        benchmark::DoNotOptimize(total);
+    }
+    set_throughput<Type>(state, count);
+}
+
+template<typename Container, typename Type, size_t count>
+static void BM_ArrayCopy(benchmark::State &state) {
+    auto source = std::make_unique<Container>();
+    auto destination = std::make_unique<Container>();
+    for (auto _: state) {
+        *destination = *source;
+        benchmark::DoNotOptimize(destination->data());
+    }
+    set_throughput<Type>(state, count);
+}
+
+#define ARRAY_BENCHMARKS(Type, count)                                                                                  \
+    BENCHMARK_TEMPLATE(BM_FillAndSum, Array<Type, count>, Type, count);                                                \
+    BENCHMARK_TEMPLATE(BM_FillAndSum, std::array<Type, count>, Type, count);                                           \
+    BENCHMARK_TEMPLATE(BM_ArrayCopy, Array<Type, count>, Type, count);                                                 \
+    BENCHMARK_TEMPLATE(BM_ArrayCopy, std::array<Type, count>, Type, count)
+
+ARRAY_BENCHMARKS(int, 10);
+ARRAY_BENCHMARKS(int, 1'000);
+ARRAY_BENCHMARKS(int, 100'000);
+ARRAY_BENCHMARKS(int, 10'000'000);
+ARRAY_BENCHMARKS(Payload<64>, 10);
+ARRAY_BENCHMARKS(Payload<64>, 1'000);
+ARRAY_BENCHMARKS(Payload<64>, 100'000);
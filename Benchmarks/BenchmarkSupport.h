@@ -0,0 +1,59 @@
+#ifndef BENCHMARK_SUPPORT_H
+#define BENCHMARK_SUPPORT_H
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+// Trivially copyable element of a chosen size, ordered by its key.
+template<size_t bytes>
+struct Payload {
+    static_assert(bytes >= sizeof(uint64_t), "Payload needs room for its key");
+
+    uint64_t key;
+    unsigned char padding[bytes - sizeof(uint64_t)];
+
+    bool operator==(const Payload &other) const { return key == other.key; }
+    bool operator<(const Payload &other) const { return key < other.key; }
+    bool operator>(const Payload &other) const { return key > other.key; }
+};
+
+inline uint64_t scramble(size_t seed) {
+    return static_cast<uint64_t>(seed) * 0x9E3779B97F4A7C15ull >> 16;
+}
+
+// Deterministic pseudo-random values, so every container sees the same input.
+template<typename Type>
+Type make_value(size_t seed) {
+    if constexpr (std::is_same_v<Type, std::string>)
+        return std::to_string(scramble(seed));
+    else if constexpr (std::is_arithmetic_v<Type>)
+        return static_cast<Type>(scramble(seed));
+    else
+        return Type{scramble(seed), {}};
+}
+
+template<typename Type>
+uint64_t key_of(const Type &value) {
+    if constexpr (std::is_same_v<Type, std::string>)
+        return value.size();
+    else if constexpr (std::is_arithmetic_v<Type>)
+        return static_cast<uint64_t>(value);
+    else
+        return value.key;
+}
+
+// N goes from 10 to 10^7 for small elements. Larger ones stop at 10^6 to keep the peak memory of a run reasonable.
+template<typename Type>
+void element_counts(benchmark::internal::Benchmark *benchmark) {
+    benchmark->RangeMultiplier(10)->Range(10, sizeof(Type) <= 8 ? 10'000'000 : 1'000'000);
+}
+
+template<typename Type>
+void set_throughput(benchmark::State &state, size_t count) {
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * count * sizeof(Type)));
+}
+
+#endif // BENCHMARK_SUPPORT_H
@@ -0,0 +1,64 @@
+#include <mutex>
+#include <thread>
+
+#include "../DataStructure/ConcurrentHeap.h"
+#include "../DataStructure/Heap.h"
+#include "BenchmarkSupport.h"
+
+// Every thread pushes and pops in turn on a queue shared by all of them, which starts with a backlog so that pops
+// rarely find it empty. Compares the relaxed and strict ConcurrentHeap with a Heap behind a single mutex, from one
+// thread to twice the number of hardware threads.
+
+static constexpr size_t backlog = 100000;
+
+static unsigned max_threads() {
+    return 2 * std::max(1u, std::thread::hardware_concurrency());
+}
+
+template<QueueOrdering ordering>
+static void BM_ConcurrentHeapPushPop(benchmark::State &state) {
+    static ConcurrentHeap<int> *queue = nullptr;
+    if (state.thread_index() == 0) {
+        queue = new ConcurrentHeap<int>(ordering);
+        for (size_t i = 0; i < backlog; ++i)
+            queue->push(static_cast<int>(i));
+    }
+
+    int value = static_cast<int>(state.thread_index());
+    for (auto _: state) {
+        queue->push(value);
+        benchmark::DoNotOptimize(queue->try_pop(value));
+    }
+    state.SetItemsProcessed(2 * state.iterations());
+
+    if (state.thread_index() == 0)
+        delete queue;
+}
+
+static void BM_MutexHeapPushPop(benchmark::State &state) {
+    static std::mutex mutex;
+    static Heap<int> *heap = nullptr;
+    if (state.thread_index() == 0) {
+        heap = new Heap<int>();
+        for (size_t i = 0; i < backlog; ++i)
+            heap->push(static_cast<int>(i));
+    }
+
+    int value = static_cast<int>(state.thread_index());
+    for (auto _: state) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            heap->push(value);
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        value = heap->pop();
+    }
+    state.SetItemsProcessed(2 * state.iterations());
+
+    if (state.thread_index() == 0)
+        delete heap;
+}
+
+BENCHMARK_TEMPLATE(BM_ConcurrentHeapPushPop, QueueOrdering::relaxed)->ThreadRange(1, max_threads())->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ConcurrentHeapPushPop, QueueOrdering::strict)->ThreadRange(1, max_threads())->UseRealTime();
+BENCHMARK(BM_MutexHeapPushPop)->ThreadRange(1, max_threads())->UseRealTime();
@@ -0,0 +1,258 @@
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <queue>
+#include <random>
+#include <vector>
+
+#include "../DataStructure/Heap.h"
+#include "../DataStructure/HeapSort.h"
+#include "../DataStructure/PairingHeap.h"
+#include "../DataStructure/RadixHeap.h"
+#include "../DataStructure/TopK.h"
+#include "BenchmarkSupport.h"
+
+// Both containers are min-heaps, filled with N values and then emptied.
+template<typename Type>
+static void BM_HeapPushPop(benchmark::State &state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    for (auto _: state) {
+        Heap<Type> heap(count);
+        for (size_t i = 0; i < count; ++i)
+            heap.insert(make_value<Type>(i));
+        while (!heap.isEmpty())
+            benchmark::DoNotOptimize(heap.pop());
+    }
+    set_throughput<Type>(state, count);
+}
+
+template<typename Type>
+static void BM_PriorityQueuePushPop(benchmark::State &state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    for (auto _: state) {
+        std::priority_queue<Type, std::vector<Type>, std::greater<Type>> queue;
+        for (size_t i = 0; i < count; ++i)
+            queue.push(make_value<Type>(i));
+        while (!queue.empty()) {
+            benchmark::DoNotOptimize(queue.top());
+            queue.pop();
+        }
+    }
+    set_throughput<Type>(state, count);
+}
+
+template<typename Type>
+static void BM_PairingHeapPushPop(benchmark::State &state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    for (auto _: state) {
+        PairingHeap<Type> heap;
+        for (size_t i = 0; i < count; ++i)
+            heap.insert(make_value<Type>(i));
+        while (!heap.isEmpty())
+            benchmark::DoNotOptimize(heap.pop());
+    }
+    set_throughput<Type>(state, count);
+}
+
+// End of a parallel phase: N values spread over 8 per-thread queues are gathered into the first one. Only the
+// gathering is timed, not the filling nor the destruction of the queues. The number of iterations is fixed, since O(1)
+// merges would otherwise have the benchmark fill the queues millions of times.
+static constexpr size_t merged_queues = 8;
+
+template<typename Queue, typename Gather>
+static void merge_workload(benchmark::State &state, Gather gather) {
+    const auto count = static_cast<size_t>(state.range(0));
+    std::vector<Queue> queues;
+    for (auto _: state) {
+        state.PauseTiming();
+        queues.clear();
+        queues.resize(merged_queues);
+        for (size_t i = 0; i < count; ++i)
+            queues[i % merged_queues].push(make_value<int>(i * 7919 % count));
+        state.ResumeTiming();
+
+        for (size_t index = 1; index < merged_queues; ++index)
+            gather(queues[0], queues[index]);
+        benchmark::DoNotOptimize(queues[0].peek());
+    }
+    set_throughput<int>(state, count);
+}
+
+static void BM_PairingHeapMerge(benchmark::State &state) {
+    merge_workload<PairingHeap<int>>(state, [](PairingHeap<int> &into, PairingHeap<int> &from) { into.merge(from); });
+}
+
+static void BM_HeapDrainMerge(benchmark::State &state) {
+    merge_workload<Heap<int>>(state, [](Heap<int> &into, Heap<int> &from) {
+        while (!from.isEmpty())
+            into.push(from.pop());
+    });
+}
+
+BENCHMARK(BM_PairingHeapMerge)->RangeMultiplier(10)->Range(1000, 1000000)->Iterations(50);
+BENCHMARK(BM_HeapDrainMerge)->RangeMultiplier(10)->Range(1000, 1000000)->Iterations(50);
+
+// Building a heap out of N unordered values, by Floyd's heapify against one insert per value.
+template<typename Type>
+static void BM_HeapFromRange(benchmark::State &state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    std::vector<Type> source;
+    for (size_t i = 0; i < count; ++i)
+        source.push_back(make_value<Type>(i * 7919 % count));
+
+    for (auto _: state) {
+        Heap<Type> heap(source.begin(), source.end());
+        benchmark::DoNotOptimize(heap.peek());
+    }
+    set_throughput<Type>(state, count);
+}
+
+template<typename Type>
+static void BM_HeapFromInserts(benchmark::State &state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    std::vector<Type> source;
+    for (size_t i = 0; i < count; ++i)
+        source.push_back(make_value<Type>(i * 7919 % count));
+
+    for (auto _: state) {
+        Heap<Type> heap(count);
+        for (const Type &value: source)
+            heap.insert(value);
+        benchmark::DoNotOptimize(heap.peek());
+    }
+    set_throughput<Type>(state, count);
+}
+
+// Pop-heavy workload: the heap is built once from N values and then emptied, so nearly all the time goes to the
+// sift-downs, whose cost depends on the arity.
+template<typename Type, size_t arity>
+static void BM_DaryHeapPopAll(benchmark::State &state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    std::vector<Type> source;
+    for (size_t i = 0; i < count; ++i)
+        source.push_back(make_value<Type>(i * 7919 % count));
+
+    for (auto _: state) {
+        DaryHeap<Type, arity> heap(source.begin(), source.end());
+        while (!heap.isEmpty())
+            benchmark::DoNotOptimize(heap.pop());
+    }
+    set_throughput<Type>(state, count);
+}
+
+// Selecting the 100 greatest of N values, with a bounded TopK against a heap holding the whole stream.
+template<typename Type>
+static void BM_TopK(benchmark::State &state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    std::vector<Type> stream;
+    for (size_t i = 0; i < count; ++i)
+        stream.push_back(make_value<Type>(i * 7919 % count));
+
+    for (auto _: state) {
+        TopK<Type> top(100);
+        top.push_n(stream.begin(), stream.size());
+        benchmark::DoNotOptimize(top.take());
+    }
+    set_throughput<Type>(state, count);
+}
+
+template<typename Type>
+static void BM_TopKFromFullHeap(benchmark::State &state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    std::vector<Type> stream;
+    for (size_t i = 0; i < count; ++i)
+        stream.push_back(make_value<Type>(i * 7919 % count));
+
+    for (auto _: state) {
+        Heap<Type, std::greater<Type>> heap(count);
+        for (const Type &value: stream)
+            heap.insert(value);
+        std::vector<Type> top;
+        heap.pop_n(100, std::back_inserter(top));
+        benchmark::DoNotOptimize(top);
+    }
+    set_throughput<Type>(state, count);
+}
+
+// Sorting the 100 smallest of N values to the front, against std::partial_sort.
+template<typename Type>
+static void BM_PartialSort(benchmark::State &state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    std::vector<Type> source;
+    for (size_t i = 0; i < count; ++i)
+        source.push_back(make_value<Type>(i * 7919 % count));
+
+    for (auto _: state) {
+        state.PauseTiming();
+        std::vector<Type> values = source;
+        state.ResumeTiming();
+        heap::partial_sort(values, 100);
+        benchmark::DoNotOptimize(values.data());
+    }
+    set_throughput<Type>(state, count);
+}
+
+template<typename Type>
+static void BM_StdPartialSort(benchmark::State &state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    std::vector<Type> source;
+    for (size_t i = 0; i < count; ++i)
+        source.push_back(make_value<Type>(i * 7919 % count));
+
+    for (auto _: state) {
+        state.PauseTiming();
+        std::vector<Type> values = source;
+        state.ResumeTiming();
+        std::partial_sort(values.begin(), values.begin() + std::min<size_t>(100, count), values.end());
+        benchmark::DoNotOptimize(values.data());
+    }
+    set_throughput<Type>(state, count);
+}
+
+// Monotone workload of an event simulation: N events are pending and each one popped schedules the next one, a random
+// delay later, as Dijkstra would relax an edge.
+template<typename Queue>
+static void monotone_workload(benchmark::State &state, Queue &queue) {
+    const auto count = static_cast<size_t>(state.range(0));
+    std::mt19937_64 random(1);
+    for (size_t i = 0; i < count; ++i)
+        queue.insert(random() % 1000);
+
+    for (auto _: state) {
+        const uint64_t now = queue.pop();
+        queue.insert(now + random() % 1000);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_RadixHeapMonotone(benchmark::State &state) {
+    RadixHeap<uint64_t> queue;
+    monotone_workload(state, queue);
+}
+
+static void BM_HeapMonotone(benchmark::State &state) {
+    Heap<uint64_t> queue;
+    monotone_workload(state, queue);
+}
+
+BENCHMARK(BM_RadixHeapMonotone)->RangeMultiplier(10)->Range(100, 1000000);
+BENCHMARK(BM_HeapMonotone)->RangeMultiplier(10)->Range(100, 1000000);
+
+#define HEAP_BENCHMARKS(Type)                                                                                          \
+    BENCHMARK_TEMPLATE(BM_HeapPushPop, Type)->Apply(element_counts<Type>);                                             \
+    BENCHMARK_TEMPLATE(BM_PriorityQueuePushPop, Type)->Apply(element_counts<Type>);                                    \
+    BENCHMARK_TEMPLATE(BM_PairingHeapPushPop, Type)->Apply(element_counts<Type>);                                      \
+    BENCHMARK_TEMPLATE(BM_HeapFromRange, Type)->Apply(element_counts<Type>);                                           \
+    BENCHMARK_TEMPLATE(BM_HeapFromInserts, Type)->Apply(element_counts<Type>);                                         \
+    BENCHMARK_TEMPLATE(BM_DaryHeapPopAll, Type, 2)->Apply(element_counts<Type>);                                      \
+    BENCHMARK_TEMPLATE(BM_DaryHeapPopAll, Type, 4)->Apply(element_counts<Type>);                                      \
+    BENCHMARK_TEMPLATE(BM_DaryHeapPopAll, Type, 8)->Apply(element_counts<Type>);                                      \
+    BENCHMARK_TEMPLATE(BM_TopK, Type)->Apply(element_counts<Type>);                                                    \
+    BENCHMARK_TEMPLATE(BM_TopKFromFullHeap, Type)->Apply(element_counts<Type>);                                        \
+    BENCHMARK_TEMPLATE(BM_PartialSort, Type)->Apply(element_counts<Type>);                                             \
+    BENCHMARK_TEMPLATE(BM_StdPartialSort, Type)->Apply(element_counts<Type>)
+
+HEAP_BENCHMARKS(int);
+HEAP_BENCHMARKS(Payload<64>);
+HEAP_BENCHMARKS(std::string);
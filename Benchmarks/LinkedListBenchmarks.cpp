@@ -0,0 +1,160 @@
+#include <forward_list>
+#include <list>
+#include <memory>
+
+#include "../DataStructure/DoublyLinkedList.h"
+#include "../DataStructure/IntrusiveList.h"
+#include "../DataStructure/LinkedList.h"
+#include "../DataStructure/List.h"
+#include "../DataStructure/UnrolledLinkedList.h"
+#include "BenchmarkSupport.h"
+
+template<typename Container, typename Type>
+static void BM_PushFront(benchmark::State &state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    for (auto _: state) {
+        Container container;
+        for (size_t i = 0; i < count; ++i)
+            container.push_front(make_value<Type>(i));
+        benchmark::DoNotOptimize(container.front());
+    }
+    set_throughput<Type>(state, count);
+}
+
+template<typename Container, typename Type>
+static void BM_Traverse(benchmark::State &state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    Container container;
+    for (size_t i = 0; i < count; ++i)
+        container.push_front(make_value<Type>(i));
+
+    for (auto _: state) {
+        uint64_t total = 0;
+        for (const Type &value: container)
+            total += key_of(value);
+        benchmark::DoNotOptimize(total);
+    }
+    set_throughput<Type>(state, count);
+}
+
+// Traversal of a list built while another one grows alongside it, as lists in a real program do: per-node
+// allocations interleave the nodes of both lists, the node pool keeps each list's nodes together.
+template<typename Container, typename Type>
+static void BM_TraverseInterleaved(benchmark::State &state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    Container container;
+    Container neighbour;
+    for (size_t i = 0; i < count; ++i) {
+        container.push_front(make_value<Type>(i));
+        neighbour.push_front(make_value<Type>(i));
+    }
+
+    for (auto _: state) {
+        uint64_t total = 0;
+        for (const Type &value: container)
+            total += key_of(value);
+        benchmark::DoNotOptimize(total);
+    }
+    set_throughput<Type>(state, count);
+}
+
+// insert_at after the first element: past the iterator walk, which does not depend on the list, an insertion costs the
+// same anywhere in the list, and begin() stays valid across insertions where an iterator to a split node would not.
+template<typename Container, typename Type>
+static void BM_InsertAt(benchmark::State &state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    for (auto _: state) {
+        Container container;
+        container.push_back(make_value<Type>(0));
+        for (size_t i = 1; i < count; ++i)
+            container.insert_at(container.begin(), make_value<Type>(i));
+        benchmark::DoNotOptimize(container.back());
+    }
+    set_throughput<Type>(state, count);
+}
+
+// Sorts a list of pseudo-random values, which are relinked rather than moved. Building and destroying the list are not
+// timed.
+template<typename Container, typename Type>
+static void BM_Sort(benchmark::State &state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    for (auto _: state) {
+        state.PauseTiming();
+        auto container = std::make_unique<Container>();
+        for (size_t i = 0; i < count; ++i)
+            container->push_back(make_value<Type>(i));
+        state.ResumeTiming();
+
+        container->sort();
+        benchmark::DoNotOptimize(container->front());
+
+        state.PauseTiming();
+        container.reset();
+        state.ResumeTiming();
+    }
+    set_throughput<Type>(state, count);
+}
+
+template<typename Type>
+struct Linkable : IntrusiveListHook<> {
+    Type value;
+};
+
+// Puts objects the program already owns in a list and takes them out again, as a scheduler does with its tasks: an
+// IntrusiveList links the objects themselves, where a LinkedList copies each one into a node of its own.
+template<typename Type>
+static void BM_LinkObjects(benchmark::State &state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    List<Linkable<Type>> objects;
+    for (size_t i = 0; i < count; ++i)
+        objects.push_back({{}, make_value<Type>(i)});
+
+    for (auto _: state) {
+        IntrusiveList<Linkable<Type>> list;
+        for (Linkable<Type> &object: objects)
+            list.push_back(object);
+        while (!list.is_empty())
+            list.pop_front();
+        benchmark::DoNotOptimize(list.size());
+    }
+    set_throughput<Type>(state, count);
+}
+
+template<typename Type>
+static void BM_CopyObjects(benchmark::State &state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    List<Linkable<Type>> objects;
+    for (size_t i = 0; i < count; ++i)
+        objects.push_back({{}, make_value<Type>(i)});
+
+    for (auto _: state) {
+        LinkedList<Linkable<Type>> list;
+        for (const Linkable<Type> &object: objects)
+            list.push_back(object);
+        while (!list.is_empty())
+            list.pop_front();
+        benchmark::DoNotOptimize(list.size());
+    }
+    set_throughput<Type>(state, count);
+}
+
+#define LINKED_LIST_BENCHMARKS(Type)                                                                                   \
+    BENCHMARK_TEMPLATE(BM_PushFront, LinkedList<Type>, Type)->Apply(element_counts<Type>);                             \
+    BENCHMARK_TEMPLATE(BM_PushFront, std::forward_list<Type>, Type)->Apply(element_counts<Type>);                      \
+    BENCHMARK_TEMPLATE(BM_Traverse, LinkedList<Type>, Type)->Apply(element_counts<Type>);                              \
+    BENCHMARK_TEMPLATE(BM_Traverse, std::forward_list<Type>, Type)->Apply(element_counts<Type>);                       \
+    BENCHMARK_TEMPLATE(BM_TraverseInterleaved, LinkedList<Type>, Type)->Apply(element_counts<Type>);                   \
+    BENCHMARK_TEMPLATE(BM_TraverseInterleaved, std::forward_list<Type>, Type)->Apply(element_counts<Type>);            \
+    BENCHMARK_TEMPLATE(BM_PushFront, UnrolledLinkedList<Type>, Type)->Apply(element_counts<Type>);                     \
+    BENCHMARK_TEMPLATE(BM_Traverse, UnrolledLinkedList<Type>, Type)->Apply(element_counts<Type>);                      \
+    BENCHMARK_TEMPLATE(BM_TraverseInterleaved, UnrolledLinkedList<Type>, Type)->Apply(element_counts<Type>);           \
+    BENCHMARK_TEMPLATE(BM_InsertAt, LinkedList<Type>, Type)->Apply(element_counts<Type>);                              \
+    BENCHMARK_TEMPLATE(BM_InsertAt, UnrolledLinkedList<Type>, Type)->Apply(element_counts<Type>);                      \
+    BENCHMARK_TEMPLATE(BM_Sort, DoublyLinkedList<Type>, Type)->RangeMultiplier(10)->Range(1'000, 1'000'000);           \
+    BENCHMARK_TEMPLATE(BM_Sort, std::list<Type>, Type)->RangeMultiplier(10)->Range(1'000, 1'000'000);                  \
+    BENCHMARK_TEMPLATE(BM_LinkObjects, Type)->Apply(element_counts<Type>);                                             \
+    BENCHMARK_TEMPLATE(BM_CopyObjects, Type)->Apply(element_counts<Type>)
+
+LINKED_LIST_BENCHMARKS(int);
+LINKED_LIST_BENCHMARKS(Payload<64>);
+LINKED_LIST_BENCHMARKS(std::string);
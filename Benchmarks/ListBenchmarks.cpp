@@ -0,0 +1,85 @@
+#include <vector>
+
+#include "../DataStructure/List.h"
+#include "BenchmarkSupport.h"
+
+template<typename Container, typename Type>
+static void BM_PushBack(benchmark::State &state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    for (auto _: state) {
+        Container container;
+        for (size_t i = 0; i < count; ++i)
+            container.push_back(make_value<Type>(i));
+        benchmark::DoNotOptimize(container.data());
+    }
+    set_throughput<Type>(state, count);
+}
+
+template<typename Container, typename Type>
+static void BM_Iterate(benchmark::State &state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    Container container;
+    for (size_t i = 0; i < count; ++i)
+        container.push_back(make_value<Type>(i));
+
+    for (auto _: state) {
+        uint64_t total = 0;
+        for (const Type &value: container)
+            total += key_of(value);
+        benchmark::DoNotOptimize(total);
+    }
+    set_throughput<Type>(state, count);
+}
+
+template<typename Container, typename Type>
+static void BM_Copy(benchmark::State &state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    Container container;
+    for (size_t i = 0; i < count; ++i)
+        container.push_back(make_value<Type>(i));
+
+    for (auto _: state) {
+        Container copy(container);
+        benchmark::DoNotOptimize(copy.data());
+    }
+    set_throughput<Type>(state, count);
+}
+
+// Front insertion shifts every element, so N stays small.
+template<typename Type>
+static void BM_ListPushFront(benchmark::State &state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    for (auto _: state) {
+        List<Type> list;
+        for (size_t i = 0; i < count; ++i)
+            list.push_front(make_value<Type>(i));
+        benchmark::DoNotOptimize(list.data());
+    }
+    set_throughput<Type>(state, count);
+}
+
+template<typename Type>
+static void BM_VectorInsertFront(benchmark::State &state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    for (auto _: state) {
+        std::vector<Type> vector;
+        for (size_t i = 0; i < count; ++i)
+            vector.insert(vector.begin(), make_value<Type>(i));
+        benchmark::DoNotOptimize(vector.data());
+    }
+    set_throughput<Type>(state, count);
+}
+
+#define LIST_BENCHMARKS(Type)                                                                                          \
+    BENCHMARK_TEMPLATE(BM_PushBack, List<Type>, Type)->Apply(element_counts<Type>);                                    \
+    BENCHMARK_TEMPLATE(BM_PushBack, std::vector<Type>, Type)->Apply(element_counts<Type>);                             \
+    BENCHMARK_TEMPLATE(BM_Iterate, List<Type>, Type)->Apply(element_counts<Type>);                                     \
+    BENCHMARK_TEMPLATE(BM_Iterate, std::vector<Type>, Type)->Apply(element_counts<Type>);                              \
+    BENCHMARK_TEMPLATE(BM_Copy, List<Type>, Type)->Apply(element_counts<Type>);                                        \
+    BENCHMARK_TEMPLATE(BM_Copy, std::vector<Type>, Type)->Apply(element_counts<Type>);                                 \
+    BENCHMARK_TEMPLATE(BM_ListPushFront, Type)->RangeMultiplier(10)->Range(10, 10'000);                                \
+    BENCHMARK_TEMPLATE(BM_VectorInsertFront, Type)->RangeMultiplier(10)->Range(10, 10'000)
+
+LIST_BENCHMARKS(int);
+LIST_BENCHMARKS(Payload<64>);
+LIST_BENCHMARKS(std::string);
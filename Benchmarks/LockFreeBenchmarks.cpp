@@ -0,0 +1,98 @@
+#include <mutex>
+#include <thread>
+
+#include "../DataStructure/LinkedList.h"
+#include "../DataStructure/LockFreeStack.h"
+#include "../DataStructure/MpscQueue.h"
+#include "BenchmarkSupport.h"
+
+// The lock-free MpscQueue and LockFreeStack against a LinkedList behind a mutex, from one thread to twice the number of
+// hardware threads. In the queue benchmarks every thread pushes and thread 0, the single consumer, also pops, so the
+// queue grows with the other threads' pushes. In the stack benchmarks every thread pushes and pops in turn.
+
+static unsigned max_threads() {
+    return 2 * std::max(1u, std::thread::hardware_concurrency());
+}
+
+static void BM_MpscQueuePushPop(benchmark::State &state) {
+    static MpscQueue<int> *queue = nullptr;
+    if (state.thread_index() == 0)
+        queue = new MpscQueue<int>();
+
+    int value = static_cast<int>(state.thread_index());
+    for (auto _: state) {
+        queue->push_back(value);
+        if (state.thread_index() == 0)
+            benchmark::DoNotOptimize(queue->try_pop_front(value));
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index() == 0)
+        delete queue;
+}
+
+static void BM_MutexQueuePushPop(benchmark::State &state) {
+    static std::mutex mutex;
+    static LinkedList<int> *queue = nullptr;
+    if (state.thread_index() == 0)
+        queue = new LinkedList<int>();
+
+    int value = static_cast<int>(state.thread_index());
+    for (auto _: state) {
+        std::lock_guard<std::mutex> lock(mutex);
+        queue->push_back(value);
+        if (state.thread_index() == 0) {
+            value = queue->front();
+            queue->pop_front();
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index() == 0)
+        delete queue;
+}
+
+static void BM_LockFreeStackPushPop(benchmark::State &state) {
+    static LockFreeStack<int> *stack = nullptr;
+    if (state.thread_index() == 0)
+        stack = new LockFreeStack<int>();
+
+    int value = static_cast<int>(state.thread_index());
+    for (auto _: state) {
+        stack->push_front(value);
+        benchmark::DoNotOptimize(stack->try_pop_front(value));
+    }
+    state.SetItemsProcessed(2 * state.iterations());
+
+    if (state.thread_index() == 0)
+        delete stack;
+}
+
+static void BM_MutexStackPushPop(benchmark::State &state) {
+    static std::mutex mutex;
+    static LinkedList<int> *stack = nullptr;
+    if (state.thread_index() == 0)
+        stack = new LinkedList<int>();
+
+    int value = static_cast<int>(state.thread_index());
+    for (auto _: state) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stack->push_front(value);
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!stack->is_empty()) {
+            value = stack->front();
+            stack->pop_front();
+        }
+    }
+    state.SetItemsProcessed(2 * state.iterations());
+
+    if (state.thread_index() == 0)
+        delete stack;
+}
+
+BENCHMARK(BM_MpscQueuePushPop)->ThreadRange(1, max_threads())->UseRealTime();
+BENCHMARK(BM_MutexQueuePushPop)->ThreadRange(1, max_threads())->UseRealTime();
+BENCHMARK(BM_LockFreeStackPushPop)->ThreadRange(1, max_threads())->UseRealTime();
+BENCHMARK(BM_MutexStackPushPop)->ThreadRange(1, max_threads())->UseRealTime();
@@ -0,0 +1,105 @@
+#include <cstdio>
+#include <filesystem>
+#include <string>
+
+#include "../DataStructure/FileBackedList.h"
+#include "../DataStructure/MappedList.h"
+#include "../DataStructure/Snapshot.h"
+#include "BenchmarkSupport.h"
+
+// Getting a List of N elements back at startup: rebuilding it element by element, loading it from a snapshot, or
+// mapping the snapshot. Mapping costs the same whatever N, the elements only being paged in as they are read, which
+// BM_MapSnapshotAndRead pays for. The snapshot stays in the page cache between iterations, as it would on a warm start.
+
+static std::string snapshot_path() {
+    return (std::filesystem::temp_directory_path() / "snapshot_benchmark.bin").string();
+}
+
+template<typename Type>
+static void save_list(size_t count) {
+    List<Type> list;
+    list.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+        list.push_back(make_value<Type>(i));
+    save_snapshot(snapshot_path(), list);
+}
+
+template<typename Type>
+static void BM_RebuildList(benchmark::State &state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    for (auto _: state) {
+        List<Type> list;
+        for (size_t i = 0; i < count; ++i)
+            list.push_back(make_value<Type>(i));
+        benchmark::DoNotOptimize(list.data());
+    }
+    set_throughput<Type>(state, count);
+}
+
+template<typename Type>
+static void BM_LoadSnapshot(benchmark::State &state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    save_list<Type>(count);
+    for (auto _: state) {
+        List<Type> list = load_list<Type>(snapshot_path());
+        benchmark::DoNotOptimize(list.data());
+    }
+    std::remove(snapshot_path().c_str());
+    set_throughput<Type>(state, count);
+}
+
+template<typename Type>
+static void BM_MapSnapshot(benchmark::State &state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    save_list<Type>(count);
+    for (auto _: state) {
+        MappedList<Type> list(snapshot_path());
+        benchmark::DoNotOptimize(list.data());
+    }
+    std::remove(snapshot_path().c_str());
+    set_throughput<Type>(state, count);
+}
+
+template<typename Type>
+static void BM_MapSnapshotAndRead(benchmark::State &state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    save_list<Type>(count);
+    for (auto _: state) {
+        MappedList<Type> list(snapshot_path());
+        uint64_t total = 0;
+        for (const Type &value: list)
+            total += key_of(value);
+        benchmark::DoNotOptimize(total);
+    }
+    std::remove(snapshot_path().c_str());
+    set_throughput<Type>(state, count);
+}
+
+// Appending to a FileBackedList, whose growth extends the file instead of relocating the elements, against a List.
+// The file is removed between iterations, so every one starts from an empty list.
+template<typename Type>
+static void BM_FileBackedPushBack(benchmark::State &state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    for (auto _: state) {
+        {
+            FileBackedList<Type> list(snapshot_path());
+            for (size_t i = 0; i < count; ++i)
+                list.push_back(make_value<Type>(i));
+            benchmark::DoNotOptimize(list.data());
+        }
+        state.PauseTiming();
+        std::remove(snapshot_path().c_str());
+        state.ResumeTiming();
+    }
+    set_throughput<Type>(state, count);
+}
+
+#define SNAPSHOT_BENCHMARKS(Type)                                                                                      \
+    BENCHMARK_TEMPLATE(BM_RebuildList, Type)->Apply(element_counts<Type>);                                             \
+    BENCHMARK_TEMPLATE(BM_LoadSnapshot, Type)->Apply(element_counts<Type>);                                            \
+    BENCHMARK_TEMPLATE(BM_MapSnapshot, Type)->Apply(element_counts<Type>);                                             \
+    BENCHMARK_TEMPLATE(BM_MapSnapshotAndRead, Type)->Apply(element_counts<Type>);                                      \
+    BENCHMARK_TEMPLATE(BM_FileBackedPushBack, Type)->Apply(element_counts<Type>)
+
+SNAPSHOT_BENCHMARKS(int);
+SNAPSHOT_BENCHMARKS(Payload<64>);
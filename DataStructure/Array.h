@@ -1,112 +1,113 @@
 #ifndef ARRAY_H
 #define ARRAY_H
 
+#include <cstddef>
+#include <stdexcept>
+
+#include "ContiguousIterator.h"
+
+// Every operation is constexpr, so a table can be computed at compile time and stored in read-only data:
+//     constexpr Array<int, 3> primes{2, 3, 5};
+// A single value fills the whole array, while two values or more initialize the first elements in order and
+// value-initialize the rest.
 template<typename Type, size_t size_temp>
 class Array {
 public:
-    Array() = default;
-    explicit Array(Type default_value);
+    constexpr Array() = default;
+    constexpr explicit Array(const Type &default_value);
+    template<typename... Rest>
+    constexpr Array(const Type &first, const Type &second, const Rest &...rest);
     ~Array() = default;
 
-    Array(const Array &other);
-    Array &operator=(const Array &other);
-    Array(Array &&other) noexcept = default;
-    Array &operator=(Array &&other) noexcept = default;
+    constexpr Array(const Array &other) = default;
+    constexpr Array &operator=(const Array &other) = default;
+    constexpr Array(Array &&other) noexcept = default;
+    constexpr Array &operator=(Array &&other) noexcept = default;
 
     [[nodiscard]] constexpr size_t size() const { return size_temp; }
 
-    Type &operator[](size_t index) { return values[index]; }
-    const Type &operator[](size_t index) const { return values[index]; }
-
-    Type &at(size_t index);
-    const Type &at(size_t index) const;
-
-    template<typename TypeConstness>
-    class IteratorTemplate {
-    public:
-        IteratorTemplate(TypeConstness *data_ptr, size_t index) : data(data_ptr), index(index) {}
-
-        TypeConstness &operator*() const { return data[index]; }
-        TypeConstness *operator->() const { return &data[index]; }
-
-        IteratorTemplate &operator++() {
-            ++index;
-            return *this;
-        }
-
-        IteratorTemplate &operator--() {
-            --index;
-            return *this;
-        }
+    constexpr Type &operator[](size_t index) { return values[index]; }
+    constexpr const Type &operator[](size_t index) const { return values[index]; }
 
-        IteratorTemplate &operator+=(size_t increment) {
-            index += increment;
-            return *this;
-        }
+    constexpr Type *data() { return values; }
+    constexpr const Type *data() const { return values; }
 
-        IteratorTemplate &operator-=(size_t increment) {
-            index -= increment;
-            return *this;
-        }
+    constexpr Type &at(size_t index);
+    constexpr const Type &at(size_t index) const;
 
-        bool operator!=(const IteratorTemplate &other) const { return index != other.index; }
-        bool operator==(const IteratorTemplate &other) const { return index == other.index; }
+    constexpr void fill(const Type &value);
 
-    private:
-        TypeConstness *data;
-        size_t index;
-    };
+    constexpr bool operator==(const Array &other) const;
+    constexpr bool operator!=(const Array &other) const { return !(*this == other); }
+    constexpr bool operator<(const Array &other) const;
+    constexpr bool operator>(const Array &other) const { return other < *this; }
+    constexpr bool operator<=(const Array &other) const { return !(other < *this); }
+    constexpr bool operator>=(const Array &other) const { return !(*this < other); }
 
-    using Iterator = IteratorTemplate<Type>;
-    using ConstIterator = IteratorTemplate<const Type>;
+    using Iterator = ContiguousIterator<Type>;
+    using ConstIterator = ContiguousIterator<const Type>;
 
-    Iterator begin() { return Iterator(values, 0); }
-    Iterator end() { return Iterator(values, size_temp); }
-    ConstIterator begin() const { return ConstIterator(values, 0); }
-    ConstIterator end() const { return ConstIterator(values, size_temp); }
-    ConstIterator cbegin() const { return ConstIterator(values, 0); }
-    ConstIterator cend() const { return ConstIterator(values, size_temp); }
+    constexpr Iterator begin() { return Iterator(values, 0); }
+    constexpr Iterator end() { return Iterator(values, size_temp); }
+    constexpr ConstIterator begin() const { return ConstIterator(values, 0); }
+    constexpr ConstIterator end() const { return ConstIterator(values, size_temp); }
+    constexpr ConstIterator cbegin() const { return ConstIterator(values, 0); }
+    constexpr ConstIterator cend() const { return ConstIterator(values, size_temp); }
 
 private:
-    Type values[size_temp];
+    Type values[size_temp]{};
 };
 
 template<typename Type, size_t size_temp>
-Array<Type, size_temp>::Array(Type default_value) {
-    for (size_t index = 0; index < size_temp; ++index) {
-        values[index] = default_value;
-    }
+constexpr Array<Type, size_temp>::Array(const Type &default_value) {
+    fill(default_value);
 }
 
 template<typename Type, size_t size_temp>
-Array<Type, size_temp>::Array(const Array &other) {
-    for (size_t index = 0; index < size_temp; ++index) {
-        values[index] = other[index];
-    }
+template<typename... Rest>
+constexpr Array<Type, size_temp>::Array(const Type &first, const Type &second, const Rest &...rest) :
+    values{first, second, static_cast<Type>(rest)...} {
+    static_assert(2 + sizeof...(Rest) <= size_temp, "Too many values for the Array size");
+}
+
+template<typename Type, size_t size_temp>
+constexpr Type &Array<Type, size_temp>::at(size_t index) {
+    return const_cast<Type &>(static_cast<const Array &>(*this).at(index));
 }
 
 template<typename Type, size_t size_temp>
-Array<Type, size_temp> &Array<Type, size_temp>::operator=(const Array &other) {
-    if (this == &other)
-        return *this;
+constexpr const Type &Array<Type, size_temp>::at(size_t index) const {
+    if (index >= size_temp) {
+        throw std::out_of_range("Array index out of range");
+    }
+    return values[index];
+}
 
+template<typename Type, size_t size_temp>
+constexpr void Array<Type, size_temp>::fill(const Type &value) {
     for (size_t index = 0; index < size_temp; ++index) {
-        values[index] = other[index];
+        values[index] = value;
     }
-    return *this;
 }
 
 template<typename Type, size_t size_temp>
-Type &Array<Type, size_temp>::at(size_t index) {
-    return const_cast<Type &>(static_cast<const Array &>(*this).at(index));
+constexpr bool Array<Type, size_temp>::operator==(const Array &other) const {
+    for (size_t index = 0; index < size_temp; ++index) {
+        if (!(values[index] == other.values[index]))
+            return false;
+    }
+    return true;
 }
 
 template<typename Type, size_t size_temp>
-const Type &Array<Type, size_temp>::at(size_t index) const {
-    if (index >= size_temp) {
-        throw std::out_of_range("Array index out of range");
+constexpr bool Array<Type, size_temp>::operator<(const Array &other) const {
+    for (size_t index = 0; index < size_temp; ++index) {
+        if (values[index] < other.values[index])
+            return true;
+        if (other.values[index] < values[index])
+            return false;
     }
-    return values[index];
+    return false;
 }
 
 #endif // ARRAY_H
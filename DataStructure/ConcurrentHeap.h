@@ -0,0 +1,163 @@
+#ifndef CONCURRENT_HEAP_H
+#define CONCURRENT_HEAP_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <utility>
+
+#include "Heap.h"
+
+enum class QueueOrdering {
+    // Pops return one of the best elements, not always the best: the element spread between shards is what lets
+    // threads work on different shards at once.
+    relaxed,
+    // Pops always return the best element, from a single heap behind a single lock.
+    strict,
+};
+
+// A priority queue shared between threads. The relaxed queue is a multi-queue: elements are spread over several
+// Heaps, each behind its own lock, pushes go to a random shard whose lock is free, and pops take the better top of
+// two random shards. Under contention threads mostly work on different shards, so throughput grows with the number of
+// cores, at the price of each pop being off by about the number of shards in rank.
+template<typename Type, typename Comparator = std::less<Type>, typename Allocator = std::allocator<Type>>
+class ConcurrentHeap {
+public:
+    // shard_count 0 picks twice the number of hardware threads. A strict queue always has a single shard.
+    explicit ConcurrentHeap(QueueOrdering ordering = QueueOrdering::relaxed, size_t shard_count = 0,
+                            Comparator comparator = Comparator(), const Allocator &allocator = Allocator());
+
+    ConcurrentHeap(const ConcurrentHeap &other) = delete;
+    ConcurrentHeap &operator=(const ConcurrentHeap &other) = delete;
+
+    void push(const Type &value) { emplace(value); }
+    void push(Type &&value) { emplace(std::move(value)); }
+    template<typename... Args>
+    void emplace(Args &&...args);
+
+    // Moves an element into value and returns true, or returns false when the queue was found empty.
+    bool try_pop(Type &value);
+
+    // Both are snapshots, which other threads may have changed by the time they are used.
+    [[nodiscard]] bool isEmpty() const { return size() == 0; }
+    [[nodiscard]] size_t size() const { return _size.load(std::memory_order_relaxed); }
+    [[nodiscard]] size_t shard_count() const { return _shard_count; }
+    // The stats of every shard added up, each read under its lock.
+    [[nodiscard]] ContainerStats stats() const;
+
+private:
+    // Each shard gets its own cache lines, so that locking one does not slow down the threads using its neighbours.
+    struct alignas(64) Shard {
+        std::mutex mutex;
+        Heap<Type, Comparator, Allocator> heap;
+    };
+
+    size_t random_shard() const;
+    bool pop_better(Shard &first, Shard &second, Type &value);
+
+    std::unique_ptr<Shard[]> shards;
+    size_t _shard_count;
+    Comparator comparator;
+    std::atomic<size_t> _size{0};
+};
+
+template<typename Type, typename Comparator, typename Allocator>
+ConcurrentHeap<Type, Comparator, Allocator>::ConcurrentHeap(QueueOrdering ordering, size_t shard_count,
+                                                            Comparator comparator, const Allocator &allocator) :
+    comparator(comparator) {
+    if (ordering == QueueOrdering::strict)
+        shard_count = 1;
+    else if (shard_count == 0)
+        shard_count = 2 * std::max(1u, std::thread::hardware_concurrency());
+
+    _shard_count = shard_count;
+    shards = std::make_unique<Shard[]>(shard_count);
+    for (size_t index = 0; index < shard_count; ++index)
+        shards[index].heap = Heap<Type, Comparator, Allocator>(comparator, allocator);
+}
+
+// A busy shard is skipped for another one, until every attempt failed and the thread waits for the last one it drew.
+template<typename Type, typename Comparator, typename Allocator>
+template<typename... Args>
+void ConcurrentHeap<Type, Comparator, Allocator>::emplace(Args &&...args) {
+    for (size_t attempt = 1;; ++attempt) {
+        Shard &shard = shards[random_shard()];
+        std::unique_lock<std::mutex> lock(shard.mutex, std::defer_lock);
+        if (attempt >= _shard_count)
+            lock.lock();
+        else if (!lock.try_lock())
+            continue;
+
+        shard.heap.emplace(std::forward<Args>(args)...);
+        _size.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+}
+
+// Random pairs find an element quickly while the queue holds many, but can keep missing the last few: once the
+// attempts are spent, every shard is visited in turn.
+template<typename Type, typename Comparator, typename Allocator>
+bool ConcurrentHeap<Type, Comparator, Allocator>::try_pop(Type &value) {
+    if (isEmpty())
+        return false;
+
+    for (size_t attempt = 0; attempt < _shard_count && !isEmpty(); ++attempt) {
+        if (pop_better(shards[random_shard()], shards[random_shard()], value))
+            return true;
+    }
+
+    for (size_t index = 0; index < _shard_count; ++index) {
+        if (pop_better(shards[index], shards[index], value))
+            return true;
+    }
+    return false;
+}
+
+template<typename Type, typename Comparator, typename Allocator>
+size_t ConcurrentHeap<Type, Comparator, Allocator>::random_shard() const {
+    if (_shard_count == 1)
+        return 0;
+
+    thread_local std::minstd_rand engine(
+        static_cast<std::minstd_rand::result_type>(std::hash<std::thread::id>()(std::this_thread::get_id())));
+    return engine() % _shard_count;
+}
+
+template<typename Type, typename Comparator, typename Allocator>
+ContainerStats ConcurrentHeap<Type, Comparator, Allocator>::stats() const {
+    ContainerStats stats;
+    for (size_t index = 0; index < _shard_count; ++index) {
+        std::lock_guard<std::mutex> lock(shards[index].mutex);
+        stats += shards[index].heap.stats();
+    }
+    return stats;
+}
+
+template<typename Type, typename Comparator, typename Allocator>
+bool ConcurrentHeap<Type, Comparator, Allocator>::pop_better(Shard &first, Shard &second, Type &value) {
+    Shard *chosen = &first;
+    std::unique_lock<std::mutex> first_lock(first.mutex, std::defer_lock);
+    std::unique_lock<std::mutex> second_lock(second.mutex, std::defer_lock);
+    if (&first == &second) {
+        first_lock.lock();
+    } else {
+        std::lock(first_lock, second_lock);
+        if (first.heap.isEmpty() ||
+            (!second.heap.isEmpty() && comparator(second.heap.peek(), first.heap.peek())))
+            chosen = &second;
+    }
+
+    if (chosen->heap.isEmpty())
+        return false;
+
+    value = chosen->heap.pop();
+    _size.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+#endif // CONCURRENT_HEAP_H
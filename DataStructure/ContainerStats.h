@@ -0,0 +1,176 @@
+#ifndef CONTAINER_STATS_H
+#define CONTAINER_STATS_H
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+// Defining DATA_STRUCTURE_STATS to 1, e.g. with -DDATA_STRUCTURE_STATS=1, makes the containers record what they do
+// into a ContainerStats returned by their stats(); those built over other containers, like TopK, RadixHeap or
+// ConcurrentHeap, add up the stats of their parts. Array and IntrusiveList allocate nothing, the file-backed lists
+// hold the page cache rather than allocations, and LockFreeStack and MpscQueue would need atomic counters, so these
+// have no stats(). Left undefined, recording compiles to nothing, the containers keep their size, and stats() returns
+// zeros. The setting must be the same for the whole program, since it changes the layout of the containers.
+#ifndef DATA_STRUCTURE_STATS
+#define DATA_STRUCTURE_STATS 0
+#endif
+
+// What a container did since it was constructed. A copy starts over, while a move hands the memory of the source
+// over to its destination, along with its bytes in current_bytes.
+struct ContainerStats {
+    size_t allocations = 0;
+    size_t deallocations = 0;
+    size_t allocated_bytes = 0;
+    // Bytes held now and at most at once, counting both buffers while a reallocation relocates the elements.
+    size_t current_bytes = 0;
+    size_t peak_bytes = 0;
+    // Buffers replaced by a larger or smaller one, the elements relocated into it.
+    size_t reallocations = 0;
+    // Elements copied or moved by the container itself: into or out of its storage, and when relocating or shifting
+    // them. Elements constructed in place by emplace count as neither.
+    size_t copies = 0;
+    size_t moves = 0;
+    // Heap sifts, and the levels they moved elements through.
+    size_t sifts = 0;
+    size_t sift_levels = 0;
+    size_t max_sift_depth = 0;
+
+    // Adds other's counts to these ones. Peaks are added as well, which bounds the peak of the whole from above.
+    ContainerStats &operator+=(const ContainerStats &other);
+
+    [[nodiscard]] std::string to_json() const;
+};
+
+inline ContainerStats &ContainerStats::operator+=(const ContainerStats &other) {
+    allocations += other.allocations;
+    deallocations += other.deallocations;
+    allocated_bytes += other.allocated_bytes;
+    current_bytes += other.current_bytes;
+    peak_bytes += other.peak_bytes;
+    reallocations += other.reallocations;
+    copies += other.copies;
+    moves += other.moves;
+    sifts += other.sifts;
+    sift_levels += other.sift_levels;
+    max_sift_depth = other.max_sift_depth > max_sift_depth ? other.max_sift_depth : max_sift_depth;
+    return *this;
+}
+
+inline std::string ContainerStats::to_json() const {
+    const std::pair<const char *, size_t> fields[] = {
+        {"allocations", allocations}, {"deallocations", deallocations}, {"allocated_bytes", allocated_bytes},
+        {"current_bytes", current_bytes}, {"peak_bytes", peak_bytes}, {"reallocations", reallocations},
+        {"copies", copies}, {"moves", moves}, {"sifts", sifts}, {"sift_levels", sift_levels},
+        {"max_sift_depth", max_sift_depth},
+    };
+
+    std::string json = "{";
+    for (const auto &[name, value]: fields) {
+        if (json.size() > 1)
+            json += ", ";
+        json += '"';
+        json += name;
+        json += "\": ";
+        json += std::to_string(value);
+    }
+    return json + "}";
+}
+
+namespace detail {
+
+    constexpr bool stats_enabled = DATA_STRUCTURE_STATS != 0;
+
+    // The private base the instrumented containers record through. Disabled, it is an empty base, which takes no
+    // room in the container, and every call is an empty inline function.
+    template<bool enabled = stats_enabled>
+    class StatsRecorder {
+    public:
+        [[nodiscard]] ContainerStats stats() const { return _stats; }
+
+    protected:
+        void record_allocation(size_t bytes) {
+            if (bytes == 0)
+                return;
+            ++_stats.allocations;
+            _stats.allocated_bytes += bytes;
+            _stats.current_bytes += bytes;
+            if (_stats.current_bytes > _stats.peak_bytes)
+                _stats.peak_bytes = _stats.current_bytes;
+        }
+
+        void record_deallocation(size_t bytes) {
+            if (bytes == 0)
+                return;
+            ++_stats.deallocations;
+            _stats.current_bytes -= bytes;
+        }
+
+        void record_reallocation() { ++_stats.reallocations; }
+        void record_copies(size_t count) { _stats.copies += count; }
+        void record_moves(size_t count) { _stats.moves += count; }
+
+        // Counts count elements relocated by detail::relocate, which copies them when moving could throw.
+        template<typename Type>
+        void record_relocation(size_t count) {
+            if constexpr (std::is_trivially_copyable_v<Type> || std::is_nothrow_move_constructible_v<Type> ||
+                          !std::is_copy_constructible_v<Type>)
+                _stats.moves += count;
+            else
+                _stats.copies += count;
+        }
+
+        void record_sift(size_t levels) {
+            ++_stats.sifts;
+            _stats.sift_levels += levels;
+            if (levels > _stats.max_sift_depth)
+                _stats.max_sift_depth = levels;
+        }
+
+        // Takes over the memory other held, along with the ownership of its storage.
+        void take_memory(StatsRecorder &other) { take_memory(other, other._stats.current_bytes); }
+
+        // Takes over bytes of it only, for storage handed over piecewise, e.g. a spliced node.
+        void take_memory(StatsRecorder &other, size_t bytes) {
+            _stats.current_bytes += bytes;
+            other._stats.current_bytes -= bytes;
+            if (_stats.current_bytes > _stats.peak_bytes)
+                _stats.peak_bytes = _stats.current_bytes;
+        }
+
+        // Takes over everything other recorded, for a temporary that did the container's work, e.g. a copy-and-move
+        // assignment.
+        void take_stats(StatsRecorder &other) {
+            take_memory(other);
+            const size_t peak_bytes = _stats.peak_bytes;
+            _stats += other._stats;
+            _stats.peak_bytes = peak_bytes;
+            other._stats = ContainerStats();
+        }
+
+    private:
+        ContainerStats _stats;
+    };
+
+    template<>
+    class StatsRecorder<false> {
+    public:
+        [[nodiscard]] ContainerStats stats() const { return {}; }
+
+    protected:
+        void record_allocation(size_t) {}
+        void record_deallocation(size_t) {}
+        void record_reallocation() {}
+        void record_copies(size_t) {}
+        void record_moves(size_t) {}
+        template<typename Type>
+        void record_relocation(size_t) {}
+        void record_sift(size_t) {}
+        void take_memory(StatsRecorder &) {}
+        void take_memory(StatsRecorder &, size_t) {}
+        void take_stats(StatsRecorder &) {}
+    };
+
+} // namespace detail
+
+#endif // CONTAINER_STATS_H
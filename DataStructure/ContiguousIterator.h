@@ -0,0 +1,122 @@
+#ifndef CONTIGUOUS_ITERATOR_H
+#define CONTIGUOUS_ITERATOR_H
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+// Random-access iterator over elements stored back to back, shared by List, SmallList and Array so that the standard
+// algorithms (std::sort, std::lower_bound, the parallel overloads, ...) run on them in place.
+// TypeConstness is either Type or const Type, and a mutable iterator converts to its const counterpart.
+template<typename TypeConstness>
+class ContiguousIterator {
+public:
+    using iterator_category = std::random_access_iterator_tag;
+#if __cplusplus >= 202002L
+    using iterator_concept = std::contiguous_iterator_tag;
+#endif
+    using value_type = std::remove_cv_t<TypeConstness>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = TypeConstness *;
+    using reference = TypeConstness &;
+
+    constexpr ContiguousIterator() = default;
+    constexpr ContiguousIterator(TypeConstness *data_ptr, size_t index) : current(data_ptr + index) {}
+
+    template<typename OtherConstness,
+             typename = std::enable_if_t<std::is_convertible_v<OtherConstness *, TypeConstness *>>>
+    constexpr ContiguousIterator(const ContiguousIterator<OtherConstness> &other) : current(other.current) {}
+
+    constexpr reference operator*() const { return *current; }
+    constexpr pointer operator->() const { return current; }
+    constexpr reference operator[](difference_type offset) const { return current[offset]; }
+
+    constexpr ContiguousIterator &operator++() {
+        ++current;
+        return *this;
+    }
+
+    constexpr ContiguousIterator operator++(int) {
+        ContiguousIterator previous = *this;
+        ++current;
+        return previous;
+    }
+
+    constexpr ContiguousIterator &operator--() {
+        --current;
+        return *this;
+    }
+
+    constexpr ContiguousIterator operator--(int) {
+        ContiguousIterator previous = *this;
+        --current;
+        return previous;
+    }
+
+    constexpr ContiguousIterator &operator+=(difference_type increment) {
+        current += increment;
+        return *this;
+    }
+
+    constexpr ContiguousIterator &operator-=(difference_type increment) {
+        current -= increment;
+        return *this;
+    }
+
+    constexpr ContiguousIterator operator+(difference_type increment) const {
+        return ContiguousIterator(current + increment);
+    }
+
+    constexpr ContiguousIterator operator-(difference_type increment) const {
+        return ContiguousIterator(current - increment);
+    }
+
+    friend constexpr ContiguousIterator operator+(difference_type increment, const ContiguousIterator &iterator) {
+        return iterator + increment;
+    }
+
+    template<typename OtherConstness>
+    constexpr difference_type operator-(const ContiguousIterator<OtherConstness> &other) const {
+        return current - other.current;
+    }
+
+    template<typename OtherConstness>
+    constexpr bool operator==(const ContiguousIterator<OtherConstness> &other) const {
+        return current == other.current;
+    }
+
+    template<typename OtherConstness>
+    constexpr bool operator!=(const ContiguousIterator<OtherConstness> &other) const {
+        return current != other.current;
+    }
+
+    template<typename OtherConstness>
+    constexpr bool operator<(const ContiguousIterator<OtherConstness> &other) const {
+        return current < other.current;
+    }
+
+    template<typename OtherConstness>
+    constexpr bool operator>(const ContiguousIterator<OtherConstness> &other) const {
+        return current > other.current;
+    }
+
+    template<typename OtherConstness>
+    constexpr bool operator<=(const ContiguousIterator<OtherConstness> &other) const {
+        return current <= other.current;
+    }
+
+    template<typename OtherConstness>
+    constexpr bool operator>=(const ContiguousIterator<OtherConstness> &other) const {
+        return current >= other.current;
+    }
+
+private:
+    constexpr explicit ContiguousIterator(TypeConstness *current) : current(current) {}
+
+    TypeConstness *current = nullptr;
+
+    template<typename OtherConstness>
+    friend class ContiguousIterator;
+};
+
+#endif // CONTIGUOUS_ITERATOR_H
@@ -0,0 +1,421 @@
+#ifndef DEQUE_H
+#define DEQUE_H
+
+#include <stdexcept>
+#include <utility>
+
+#include "ContainerStats.h"
+#include "Memory.h"
+
+// Double-ended queue on a circular buffer: same interface as List, but push/pop at both ends are amortized O(1).
+// The capacity is always a power of two so that wrapping an index is a single mask. With DATA_STRUCTURE_STATS,
+// stats() tells how it used memory, see ContainerStats.h.
+template<typename Type>
+class Deque : private detail::StatsRecorder<> {
+public:
+    using detail::StatsRecorder<>::stats;
+
+    Deque() = default;
+    ~Deque();
+
+    Deque(const Deque &other);
+    Deque &operator=(const Deque &other);
+
+    Deque(Deque &&other) noexcept;
+    Deque &operator=(Deque &&other) noexcept;
+
+    void push_back(const Type &value);
+    void push_back(Type &&value);
+    template<typename... Args>
+    Type &emplace_back(Args &&...args);
+    void pop_back();
+
+    void push_front(const Type &value);
+    void push_front(Type &&value);
+    template<typename... Args>
+    Type &emplace_front(Args &&...args);
+    void pop_front();
+
+    Type &front();
+    const Type &front() const;
+    Type &back();
+    const Type &back() const;
+
+    Type &at(size_t index);
+    const Type &at(size_t index) const;
+
+    void clear();
+    [[nodiscard]] size_t size() const;
+    [[nodiscard]] bool is_empty() const;
+
+    Type &operator[](size_t index) { return values[slot(index)]; }
+    const Type &operator[](size_t index) const { return values[slot(index)]; }
+
+    template<typename TypeConstness>
+    class IteratorTemplate {
+    public:
+        IteratorTemplate(TypeConstness *data_ptr, size_t head, size_t mask, size_t index) :
+            data(data_ptr), head(head), mask(mask), index(index) {}
+
+        TypeConstness &operator*() const { return data[(head + index) & mask]; }
+        TypeConstness *operator->() const { return &data[(head + index) & mask]; }
+
+        IteratorTemplate &operator++() {
+            ++index;
+            return *this;
+        }
+
+        IteratorTemplate &operator--() {
+            --index;
+            return *this;
+        }
+
+        IteratorTemplate &operator+=(size_t increment) {
+            index += increment;
+            return *this;
+        }
+
+        IteratorTemplate &operator-=(size_t increment) {
+            index -= increment;
+            return *this;
+        }
+
+        bool operator!=(const IteratorTemplate &other) const { return index != other.index; }
+        bool operator==(const IteratorTemplate &other) const { return index == other.index; }
+
+    private:
+        TypeConstness *data;
+        size_t head;
+        size_t mask;
+        size_t index;
+    };
+
+    using Iterator = IteratorTemplate<Type>;
+    using ConstIterator = IteratorTemplate<const Type>;
+
+    Iterator begin() { return Iterator(values, head, capacity - 1, 0); }
+    Iterator end() { return Iterator(values, head, capacity - 1, _size); }
+    ConstIterator begin() const { return ConstIterator(values, head, capacity - 1, 0); }
+    ConstIterator end() const { return ConstIterator(values, head, capacity - 1, _size); }
+    ConstIterator cbegin() const { return ConstIterator(values, head, capacity - 1, 0); }
+    ConstIterator cend() const { return ConstIterator(values, head, capacity - 1, _size); }
+
+private:
+    [[nodiscard]] size_t slot(size_t index) const { return (head + index) & (capacity - 1); }
+    [[nodiscard]] size_t grown_capacity() const { return capacity == 0 ? 8 : capacity * 2; }
+
+    void copy_into(Type *destination) const;
+    void relocate_into(Type *destination);
+    void destroy_all() noexcept;
+
+    template<typename... Args>
+    void grow_and_emplace(size_t new_slot, Args &&...args);
+    void reallocate(size_t new_capacity);
+    Type *allocate_values(size_t count);
+    void deallocate_values(Type *buffer, size_t count) noexcept;
+
+    Type *values = nullptr;
+    size_t capacity = 0;
+    size_t head = 0;
+    size_t _size = 0;
+};
+
+template<typename Type>
+Deque<Type>::~Deque() {
+    destroy_all();
+    deallocate_values(values, capacity);
+}
+
+template<typename Type>
+Deque<Type>::Deque(const Deque &other) : capacity(other.capacity), _size(other._size) {
+    values = allocate_values(capacity);
+    try {
+        other.copy_into(values);
+    } catch (...) {
+        deallocate_values(values, capacity);
+        throw;
+    }
+    record_copies(_size);
+}
+
+template<typename Type>
+Deque<Type> &Deque<Type>::operator=(const Deque &other) {
+    if (this == &other)
+        return *this;
+
+    Deque copy(other);
+    *this = std::move(copy);
+    take_stats(copy);
+    return *this;
+}
+
+template<typename Type>
+Deque<Type>::Deque(Deque &&other) noexcept :
+    values(other.values), capacity(other.capacity), head(other.head), _size(other._size) {
+    take_memory(other);
+    other.values = nullptr;
+    other.capacity = 0;
+    other.head = 0;
+    other._size = 0;
+}
+
+template<typename Type>
+Deque<Type> &Deque<Type>::operator=(Deque &&other) noexcept {
+    if (this == &other)
+        return *this;
+
+    destroy_all();
+    deallocate_values(values, capacity);
+
+    take_memory(other);
+    values = other.values;
+    capacity = other.capacity;
+    head = other.head;
+    _size = other._size;
+
+    other.values = nullptr;
+    other.capacity = 0;
+    other.head = 0;
+    other._size = 0;
+
+    return *this;
+}
+
+template<typename Type>
+void Deque<Type>::push_back(const Type &value) {
+    emplace_back(value);
+    record_copies(1);
+}
+
+template<typename Type>
+void Deque<Type>::push_back(Type &&value) {
+    emplace_back(std::move(value));
+    record_moves(1);
+}
+
+template<typename Type>
+template<typename... Args>
+Type &Deque<Type>::emplace_back(Args &&...args) {
+    if (_size == capacity) {
+        grow_and_emplace(_size, std::forward<Args>(args)...);
+    } else {
+        new (values + slot(_size)) Type(std::forward<Args>(args)...);
+    }
+
+    ++_size;
+    return back();
+}
+
+template<typename Type>
+void Deque<Type>::pop_back() {
+    if (_size == 0)
+        return;
+
+    values[slot(--_size)].~Type();
+    if (_size <= capacity / 4 && capacity > 8)
+        reallocate(capacity / 2);
+}
+
+template<typename Type>
+void Deque<Type>::push_front(const Type &value) {
+    emplace_front(value);
+    record_copies(1);
+}
+
+template<typename Type>
+void Deque<Type>::push_front(Type &&value) {
+    emplace_front(std::move(value));
+    record_moves(1);
+}
+
+template<typename Type>
+template<typename... Args>
+Type &Deque<Type>::emplace_front(Args &&...args) {
+    if (_size == capacity) {
+        // The new front goes in the last slot of the grown buffer, just before the relocated elements.
+        grow_and_emplace(grown_capacity() - 1, std::forward<Args>(args)...);
+        head = capacity - 1;
+    } else {
+        const size_t new_head = (head + capacity - 1) & (capacity - 1);
+        new (values + new_head) Type(std::forward<Args>(args)...);
+        head = new_head;
+    }
+
+    ++_size;
+    return front();
+}
+
+template<typename Type>
+void Deque<Type>::pop_front() {
+    if (_size == 0)
+        return;
+
+    values[head].~Type();
+    head = (head + 1) & (capacity - 1);
+    --_size;
+
+    if (_size <= capacity / 4 && capacity > 8)
+        reallocate(capacity / 2);
+}
+
+template<typename Type>
+Type &Deque<Type>::front() {
+    if (_size == 0)
+        throw std::out_of_range("Deque is empty");
+    return values[head];
+}
+
+template<typename Type>
+const Type &Deque<Type>::front() const {
+    if (_size == 0)
+        throw std::out_of_range("Deque is empty");
+    return values[head];
+}
+
+template<typename Type>
+Type &Deque<Type>::back() {
+    if (_size == 0)
+        throw std::out_of_range("Deque is empty");
+    return values[slot(_size - 1)];
+}
+
+template<typename Type>
+const Type &Deque<Type>::back() const {
+    if (_size == 0)
+        throw std::out_of_range("Deque is empty");
+    return values[slot(_size - 1)];
+}
+
+template<typename Type>
+Type &Deque<Type>::at(size_t index) {
+    return const_cast<Type &>(static_cast<const Deque &>(*this).at(index));
+}
+
+template<typename Type>
+const Type &Deque<Type>::at(size_t index) const {
+    if (index >= _size)
+        throw std::out_of_range("Index out of range");
+    return values[slot(index)];
+}
+
+template<typename Type>
+void Deque<Type>::clear() {
+    destroy_all();
+    deallocate_values(values, capacity);
+    values = nullptr;
+    capacity = 0;
+    head = 0;
+    _size = 0;
+}
+
+template<typename Type>
+size_t Deque<Type>::size() const {
+    return _size;
+}
+
+template<typename Type>
+bool Deque<Type>::is_empty() const {
+    return _size == 0;
+}
+
+// The live elements occupy at most two runs of the buffer: [head, capacity) and [0, wrapped).
+// The helpers below handle both runs and lay the elements out from index 0 of the destination.
+template<typename Type>
+void Deque<Type>::copy_into(Type *destination) const {
+    const size_t first_run = _size < capacity - head ? _size : capacity - head;
+    detail::uninitialized_copy(values + head, first_run, destination);
+    try {
+        detail::uninitialized_copy(values, _size - first_run, destination + first_run);
+    } catch (...) {
+        detail::destroy(destination, first_run);
+        throw;
+    }
+}
+
+template<typename Type>
+void Deque<Type>::relocate_into(Type *destination) {
+    const size_t first_run = _size < capacity - head ? _size : capacity - head;
+    // Both runs are built before either is destroyed, so that a throwing copy leaves every source element intact.
+    detail::uninitialized_move_if_noexcept(values + head, first_run, destination);
+    try {
+        detail::uninitialized_move_if_noexcept(values, _size - first_run, destination + first_run);
+    } catch (...) {
+        detail::destroy(destination, first_run);
+        throw;
+    }
+    destroy_all();
+}
+
+template<typename Type>
+void Deque<Type>::destroy_all() noexcept {
+    if (_size == 0)
+        return;
+
+    const size_t first_run = _size < capacity - head ? _size : capacity - head;
+    detail::destroy(values + head, first_run);
+    detail::destroy(values, _size - first_run);
+}
+
+template<typename Type>
+template<typename... Args>
+void Deque<Type>::grow_and_emplace(size_t new_slot, Args &&...args) {
+    // The new element is built before the old ones are relocated, as args may refer to one of them.
+    const size_t new_capacity = grown_capacity();
+    Type *new_values = allocate_values(new_capacity);
+    try {
+        new (new_values + new_slot) Type(std::forward<Args>(args)...);
+    } catch (...) {
+        deallocate_values(new_values, new_capacity);
+        throw;
+    }
+
+    try {
+        relocate_into(new_values);
+    } catch (...) {
+        new_values[new_slot].~Type();
+        deallocate_values(new_values, new_capacity);
+        throw;
+    }
+    if (values != nullptr)
+        record_reallocation();
+    record_relocation<Type>(_size);
+
+    deallocate_values(values, capacity);
+    values = new_values;
+    capacity = new_capacity;
+    head = 0;
+}
+
+template<typename Type>
+void Deque<Type>::reallocate(size_t new_capacity) {
+    Type *new_values = allocate_values(new_capacity);
+    try {
+        relocate_into(new_values);
+    } catch (...) {
+        deallocate_values(new_values, new_capacity);
+        throw;
+    }
+    record_reallocation();
+    record_relocation<Type>(_size);
+
+    deallocate_values(values, capacity);
+    values = new_values;
+    capacity = new_capacity;
+    head = 0;
+}
+
+template<typename Type>
+Type *Deque<Type>::allocate_values(size_t count) {
+    Type *buffer = detail::allocate<Type>(count);
+    record_allocation(count * sizeof(Type));
+    return buffer;
+}
+
+template<typename Type>
+void Deque<Type>::deallocate_values(Type *buffer, size_t count) noexcept {
+    if (buffer != nullptr)
+        record_deallocation(count * sizeof(Type));
+    detail::deallocate(buffer);
+}
+
+#endif // DEQUE_H
@@ -0,0 +1,405 @@
+#ifndef DOUBLY_LINKEDLIST_H
+#define DOUBLY_LINKEDLIST_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "ContainerStats.h"
+
+// A doubly linked list closed into a ring by a sentinel, which end() points to: every node has a predecessor and a
+// successor, so inserting and erasing at an iterator are O(1) without any special case for the ends.
+// splice moves nodes from another list in O(1), and merge and sort relink nodes without moving a single element.
+// Nodes are allocated one by one from Allocator rebound to the node type, rather than from a pool owned by the list,
+// so that splice can hand any node over to another list: both lists' allocators must compare equal.
+template<typename Type, typename Allocator = std::allocator<Type>>
+class DoublyLinkedList : private detail::StatsRecorder<> {
+    struct Links {
+        Links *previous;
+        Links *next;
+    };
+
+    struct Node : Links {
+        template<typename... Args>
+        explicit Node(Args &&...args) : Links{nullptr, nullptr}, value(std::forward<Args>(args)...) {}
+
+        Type value;
+    };
+
+public:
+    DoublyLinkedList() = default;
+    explicit DoublyLinkedList(const Allocator &allocator) : allocator(allocator) {}
+    ~DoublyLinkedList() noexcept { clear(); }
+
+    DoublyLinkedList(const DoublyLinkedList &other) = delete;
+    DoublyLinkedList &operator=(const DoublyLinkedList &other) = delete;
+    DoublyLinkedList(DoublyLinkedList &&other) noexcept;
+    DoublyLinkedList &operator=(DoublyLinkedList &&other) noexcept(
+        std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value ||
+        std::allocator_traits<Allocator>::is_always_equal::value);
+
+    template<typename TypeConstness>
+    struct IteratorTemplate {
+        explicit IteratorTemplate(Links *links) : current(links) {}
+
+        TypeConstness &operator*() const { return static_cast<Node *>(current)->value; }
+        TypeConstness *operator->() const { return &(static_cast<Node *>(current)->value); }
+
+        IteratorTemplate &operator++() {
+            current = current->next;
+            return *this;
+        }
+
+        IteratorTemplate &operator--() {
+            current = current->previous;
+            return *this;
+        }
+
+        bool operator==(const IteratorTemplate &other) const { return other.current == current; }
+        bool operator!=(const IteratorTemplate &other) const { return other.current != current; }
+
+    private:
+        Links *current;
+
+        friend class DoublyLinkedList;
+    };
+
+    using Iterator = IteratorTemplate<Type>;
+    using ConstIterator = IteratorTemplate<const Type>;
+
+    void push_front(Type value) { insert(begin(), std::move(value)); }
+    void push_back(Type value) { insert(end(), std::move(value)); }
+
+    void pop_front();
+    void pop_back();
+
+    Type &front() { return static_cast<Node *>(sentinel.next)->value; }
+    const Type &front() const { return static_cast<const Node *>(sentinel.next)->value; }
+
+    Type &back() { return static_cast<Node *>(sentinel.previous)->value; }
+    const Type &back() const { return static_cast<const Node *>(sentinel.previous)->value; }
+
+    // Inserts value before position and returns an iterator to it.
+    Iterator insert(const Iterator &position, Type value);
+    // Erases the element iterator points to and returns an iterator to the next one.
+    Iterator erase(const Iterator &iterator);
+
+    // Moves every element of other before position. The allocators must compare equal, otherwise invalid_argument is
+    // thrown, and iterators to the moved elements stay valid, now pointing into this list.
+    void splice(const Iterator &position, DoublyLinkedList &other);
+    // Moves the element iterator points to, out of other, before position. other may be this list.
+    void splice(const Iterator &position, DoublyLinkedList &other, const Iterator &iterator);
+
+    // Merges other, sorted by comparator, into this list, sorted as well, leaving other empty. Equivalent elements of
+    // this list come before those of other.
+    template<typename Comparator = std::less<Type>>
+    void merge(DoublyLinkedList &other, Comparator comparator = Comparator());
+
+    // A stable merge sort: O(n log n) comparisons and O(1) extra memory.
+    template<typename Comparator = std::less<Type>>
+    void sort(Comparator comparator = Comparator());
+
+    void clear();
+
+    [[nodiscard]] bool is_empty() const { return _size == 0; }
+    [[nodiscard]] size_t size() const { return _size; }
+    [[nodiscard]] Allocator get_allocator() const { return Allocator(allocator); }
+    // Spliced and merged nodes bring their bytes along, but their allocations stay counted by the list they came from.
+    using detail::StatsRecorder<>::stats;
+
+    Iterator begin() { return Iterator(sentinel.next); }
+    Iterator end() { return Iterator(&sentinel); }
+    ConstIterator begin() const { return ConstIterator(sentinel.next); }
+    ConstIterator end() const { return ConstIterator(const_cast<Links *>(&sentinel)); }
+    ConstIterator cbegin() const { return begin(); }
+    ConstIterator cend() const { return end(); }
+
+private:
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using NodeAllocatorTraits = std::allocator_traits<NodeAllocator>;
+
+    static void link_before(Links *position, Links *first, Links *last) noexcept;
+    static void unlink(Links *first, Links *last) noexcept;
+    template<typename Comparator>
+    static Links *merge_chains(Links *first, Links *second, Comparator &comparator);
+
+    void take_nodes(DoublyLinkedList &other) noexcept;
+    void check_allocator(const DoublyLinkedList &other) const;
+
+    template<typename... Args>
+    Node *create_node(Args &&...args);
+    void destroy_node(Node *node) noexcept;
+
+    NodeAllocator allocator;
+    Links sentinel{&sentinel, &sentinel};
+    size_t _size = 0;
+};
+
+template<typename Type, typename Allocator>
+DoublyLinkedList<Type, Allocator>::DoublyLinkedList(DoublyLinkedList &&other) noexcept :
+    allocator(std::move(other.allocator)) {
+    take_nodes(other);
+}
+
+template<typename Type, typename Allocator>
+DoublyLinkedList<Type, Allocator> &DoublyLinkedList<Type, Allocator>::operator=(DoublyLinkedList &&other) noexcept(
+    std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value ||
+    std::allocator_traits<Allocator>::is_always_equal::value) {
+    if (this == &other)
+        return *this;
+
+    clear();
+    if constexpr (NodeAllocatorTraits::propagate_on_container_move_assignment::value) {
+        allocator = std::move(other.allocator);
+    } else if constexpr (!NodeAllocatorTraits::is_always_equal::value) {
+        // other's nodes cannot be released through our allocator, so its values are copied into new nodes instead.
+        if (allocator != other.allocator) {
+            for (const Type &value: other)
+                push_back(value);
+            record_copies(other._size);
+            other.clear();
+            return *this;
+        }
+    }
+
+    take_nodes(other);
+    return *this;
+}
+
+template<typename Type, typename Allocator>
+void DoublyLinkedList<Type, Allocator>::pop_front() {
+    if (!is_empty())
+        erase(begin());
+}
+
+template<typename Type, typename Allocator>
+void DoublyLinkedList<Type, Allocator>::pop_back() {
+    if (!is_empty())
+        erase(Iterator(sentinel.previous));
+}
+
+template<typename Type, typename Allocator>
+typename DoublyLinkedList<Type, Allocator>::Iterator
+DoublyLinkedList<Type, Allocator>::insert(const Iterator &position, Type value) {
+    Node *node = create_node(std::move(value));
+    record_moves(1);
+    link_before(position.current, node, node);
+    _size++;
+    return Iterator(node);
+}
+
+template<typename Type, typename Allocator>
+typename DoublyLinkedList<Type, Allocator>::Iterator DoublyLinkedList<Type, Allocator>::erase(const Iterator &iterator) {
+    Links *removed = iterator.current;
+    Links *next = removed->next;
+    unlink(removed, removed);
+    destroy_node(static_cast<Node *>(removed));
+    _size--;
+    return Iterator(next);
+}
+
+template<typename Type, typename Allocator>
+void DoublyLinkedList<Type, Allocator>::splice(const Iterator &position, DoublyLinkedList &other) {
+    if (this == &other || other.is_empty())
+        return;
+    check_allocator(other);
+
+    take_memory(other);
+    Links *first = other.sentinel.next;
+    Links *last = other.sentinel.previous;
+    unlink(first, last);
+    link_before(position.current, first, last);
+    _size += other._size;
+    other._size = 0;
+}
+
+template<typename Type, typename Allocator>
+void DoublyLinkedList<Type, Allocator>::splice(const Iterator &position, DoublyLinkedList &other,
+                                               const Iterator &iterator) {
+    Links *moved = iterator.current;
+    if (moved == position.current || moved->next == position.current)
+        return;
+    if (this != &other) {
+        check_allocator(other);
+        take_memory(other, sizeof(Node));
+    }
+
+    unlink(moved, moved);
+    link_before(position.current, moved, moved);
+    other._size--;
+    _size++;
+}
+
+// Walks both lists once, moving each element of other before the first element of this list that should come after
+// it, then hands the rest of other over to the end.
+template<typename Type, typename Allocator>
+template<typename Comparator>
+void DoublyLinkedList<Type, Allocator>::merge(DoublyLinkedList &other, Comparator comparator) {
+    if (this == &other || other.is_empty())
+        return;
+    check_allocator(other);
+
+    // Every node of other ends up in this list.
+    take_memory(other);
+    Links *current = sentinel.next;
+    while (current != &sentinel && !other.is_empty()) {
+        Links *candidate = other.sentinel.next;
+        if (comparator(static_cast<Node *>(candidate)->value, static_cast<Node *>(current)->value)) {
+            unlink(candidate, candidate);
+            link_before(current, candidate, candidate);
+            other._size--;
+            _size++;
+        } else {
+            current = current->next;
+        }
+    }
+    splice(end(), other);
+}
+
+// Sorts the nodes as singly linked chains, the way a binary counter counts: each node, taken in order, is merged with
+// the runs of 1, 2, 4... nodes already sorted until it finds an empty level, where the resulting run waits. Runs are
+// merged while their nodes are still in cache, rather than by passes over the whole list, and the previous pointers
+// are only restored at the end.
+template<typename Type, typename Allocator>
+template<typename Comparator>
+void DoublyLinkedList<Type, Allocator>::sort(Comparator comparator) {
+    if (_size < 2)
+        return;
+
+    // Level i holds a run of 2^i nodes, made of nodes taken before those of any lower level.
+    Links *levels[std::numeric_limits<size_t>::digits] = {};
+    size_t used_levels = 0;
+
+    sentinel.previous->next = nullptr;
+    for (Links *current = sentinel.next; current != nullptr;) {
+        Links *run = current;
+        current = current->next;
+        run->next = nullptr;
+
+        size_t level = 0;
+        for (; levels[level] != nullptr; ++level) {
+            run = merge_chains(levels[level], run, comparator);
+            levels[level] = nullptr;
+        }
+        levels[level] = run;
+        used_levels = std::max(used_levels, level + 1);
+    }
+
+    Links *sorted = nullptr;
+    for (size_t level = 0; level < used_levels; ++level) {
+        if (levels[level] != nullptr)
+            sorted = sorted == nullptr ? levels[level] : merge_chains(levels[level], sorted, comparator);
+    }
+
+    Links *previous = &sentinel;
+    for (Links *current = sorted; current != nullptr; current = current->next) {
+        current->previous = previous;
+        previous->next = current;
+        previous = current;
+    }
+    previous->next = &sentinel;
+    sentinel.previous = previous;
+}
+
+template<typename Type, typename Allocator>
+void DoublyLinkedList<Type, Allocator>::clear() {
+    Links *current = sentinel.next;
+
+    while (current != &sentinel) {
+        Links *temp = current;
+        current = current->next;
+        destroy_node(static_cast<Node *>(temp));
+    }
+
+    sentinel.previous = sentinel.next = &sentinel;
+    _size = 0;
+}
+
+template<typename Type, typename Allocator>
+void DoublyLinkedList<Type, Allocator>::link_before(Links *position, Links *first, Links *last) noexcept {
+    Links *previous = position->previous;
+    previous->next = first;
+    first->previous = previous;
+    last->next = position;
+    position->previous = last;
+}
+
+template<typename Type, typename Allocator>
+void DoublyLinkedList<Type, Allocator>::unlink(Links *first, Links *last) noexcept {
+    first->previous->next = last->next;
+    last->next->previous = first->previous;
+}
+
+// Merges two sorted chains, taking from first on ties, and returns the head of the result.
+template<typename Type, typename Allocator>
+template<typename Comparator>
+typename DoublyLinkedList<Type, Allocator>::Links *
+DoublyLinkedList<Type, Allocator>::merge_chains(Links *first, Links *second, Comparator &comparator) {
+    Links head{nullptr, nullptr};
+    Links *tail = &head;
+    while (first != nullptr && second != nullptr) {
+        if (comparator(static_cast<Node *>(second)->value, static_cast<Node *>(first)->value)) {
+            tail->next = second;
+            second = second->next;
+        } else {
+            tail->next = first;
+            first = first->next;
+        }
+        tail = tail->next;
+    }
+
+    tail->next = first != nullptr ? first : second;
+    return head.next;
+}
+
+// The nodes point to other's sentinel at both ends, which this list's sentinel replaces.
+template<typename Type, typename Allocator>
+void DoublyLinkedList<Type, Allocator>::take_nodes(DoublyLinkedList &other) noexcept {
+    take_memory(other);
+    _size = other._size;
+    if (_size == 0)
+        return;
+
+    sentinel.next = other.sentinel.next;
+    sentinel.previous = other.sentinel.previous;
+    sentinel.next->previous = sentinel.previous->next = &sentinel;
+
+    other.sentinel.previous = other.sentinel.next = &other.sentinel;
+    other._size = 0;
+}
+
+template<typename Type, typename Allocator>
+void DoublyLinkedList<Type, Allocator>::check_allocator(const DoublyLinkedList &other) const {
+    if constexpr (!NodeAllocatorTraits::is_always_equal::value) {
+        if (allocator != other.allocator)
+            throw std::invalid_argument("DoublyLinkedList nodes cannot move between lists of unequal allocators");
+    }
+}
+
+template<typename Type, typename Allocator>
+template<typename... Args>
+typename DoublyLinkedList<Type, Allocator>::Node *DoublyLinkedList<Type, Allocator>::create_node(Args &&...args) {
+    Node *node = NodeAllocatorTraits::allocate(allocator, 1);
+    try {
+        new (node) Node(std::forward<Args>(args)...);
+    } catch (...) {
+        NodeAllocatorTraits::deallocate(allocator, node, 1);
+        throw;
+    }
+    record_allocation(sizeof(Node));
+    return node;
+}
+
+template<typename Type, typename Allocator>
+void DoublyLinkedList<Type, Allocator>::destroy_node(Node *node) noexcept {
+    node->~Node();
+    NodeAllocatorTraits::deallocate(allocator, node, 1);
+    record_deallocation(sizeof(Node));
+}
+
+#endif // DOUBLY_LINKEDLIST_H
@@ -0,0 +1,337 @@
+#ifndef FILE_BACKED_LIST_H
+#define FILE_BACKED_LIST_H
+
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ContiguousIterator.h"
+#include "GrowthPolicy.h"
+#include "Snapshot.h"
+
+// A List of trivially copyable elements whose buffer is a file mapped into memory: the elements live in the page
+// cache rather than in anonymous memory, so the kernel writes them back and evicts them under memory pressure, and a
+// list can grow past the available memory. Growing extends the file and its mapping in place (mremap on Linux), where
+// List needs both buffers resident at once while it relocates the elements. The file is sparse: reserved capacity
+// takes no disk space until written.
+// The file is a snapshot of the list, see Snapshot.h, which reopening the list continues from and which load_list and
+// MappedList read. Its element count only grows through sync() and the destructor, while removals lower it at once:
+// the count in the file never exceeds the elements the file holds, but the elements below it are whatever was last
+// written to them, which after a crash may be newer than the last sync() once removed elements were pushed again.
+// sync() is the only point where the file holds exactly the list. POSIX only.
+template<typename Type, typename GrowthPolicy = DefaultGrowth>
+class FileBackedList {
+public:
+    // Opens the list saved at path, or creates an empty one. Throws system_error when the file cannot be opened or
+    // mapped, and runtime_error when it holds something other than a List of Type.
+    explicit FileBackedList(const std::string &path);
+    ~FileBackedList();
+
+    FileBackedList(const FileBackedList &other) = delete;
+    FileBackedList &operator=(const FileBackedList &other) = delete;
+    FileBackedList(FileBackedList &&other) noexcept;
+    FileBackedList &operator=(FileBackedList &&other) noexcept;
+
+    void push_back(const Type &value) { emplace_back(value); }
+    template<typename... Args>
+    Type &emplace_back(Args &&...args);
+    void pop_back();
+
+    // All throw out_of_range on an empty list, as List does.
+    Type &front();
+    const Type &front() const;
+    Type &back();
+    const Type &back() const;
+
+    Type &at(size_t index);
+    const Type &at(size_t index) const;
+
+    // Grows the file to hold new_capacity elements.
+    void reserve(size_t new_capacity);
+    // Truncates the file to the elements it holds.
+    void shrink_to_fit();
+    // Keeps the capacity, so that the list can grow back without extending the file.
+    void clear();
+
+    // A durability point: returns once the elements, then the count of the list, reached the disk.
+    void sync();
+
+    [[nodiscard]] size_t size() const { return _size; }
+    [[nodiscard]] size_t capacity() const { return _capacity; }
+    [[nodiscard]] bool is_empty() const { return _size == 0; }
+
+    Type &operator[](size_t index) { return values[index]; }
+    const Type &operator[](size_t index) const { return values[index]; }
+
+    Type *data() { return values; }
+    const Type *data() const { return values; }
+
+    using Iterator = ContiguousIterator<Type>;
+    using ConstIterator = ContiguousIterator<const Type>;
+
+    Iterator begin() { return Iterator(values, 0); }
+    Iterator end() { return Iterator(values, _size); }
+    ConstIterator begin() const { return ConstIterator(values, 0); }
+    ConstIterator end() const { return ConstIterator(values, _size); }
+    ConstIterator cbegin() const { return ConstIterator(values, 0); }
+    ConstIterator cend() const { return ConstIterator(values, _size); }
+
+private:
+    SnapshotHeader &header() { return *static_cast<SnapshotHeader *>(mapping); }
+    [[nodiscard]] size_t file_size(size_t capacity) const { return data_offset + capacity * sizeof(Type); }
+
+    void lower_count();
+    void resize_file(size_t capacity);
+    void map(size_t capacity);
+    void close() noexcept;
+
+    int file = -1;
+    void *mapping = nullptr;
+    size_t data_offset = 0;
+    Type *values = nullptr;
+    size_t _capacity = 0;
+    size_t _size = 0;
+};
+
+template<typename Type, typename GrowthPolicy>
+FileBackedList<Type, GrowthPolicy>::FileBackedList(const std::string &path) {
+    detail::check_snapshot_element<Type>();
+
+    file = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (file < 0)
+        throw std::system_error(errno, std::generic_category(), "Cannot open " + path);
+
+    try {
+        struct stat status{};
+        if (::fstat(file, &status) != 0)
+            throw std::system_error(errno, std::generic_category(), "Cannot open " + path);
+
+        if (status.st_size == 0) {
+            // A new list: its header is written along with an empty snapshot, then mapped like any other.
+            std::ostringstream empty;
+            detail::write_snapshot<Type>(empty, SnapshotHeader::Kind::List, nullptr, 0);
+            const std::string bytes = empty.str();
+            if (::pwrite(file, bytes.data(), bytes.size(), 0) != static_cast<ssize_t>(bytes.size()))
+                throw std::system_error(errno, std::generic_category(), "Cannot write " + path);
+            status.st_size = static_cast<off_t>(bytes.size());
+        }
+
+        const auto size = static_cast<size_t>(status.st_size);
+        if (size < sizeof(SnapshotHeader))
+            throw std::runtime_error("Snapshot is truncated");
+
+        SnapshotHeader stored{};
+        if (::pread(file, &stored, sizeof(stored), 0) != static_cast<ssize_t>(sizeof(stored)))
+            throw std::system_error(errno, std::generic_category(), "Cannot read " + path);
+        const SnapshotHeader::Kind kind = SnapshotHeader::Kind::List;
+        detail::check_snapshot_header<Type>(stored, &kind, size);
+
+        data_offset = static_cast<size_t>(stored.data_offset);
+        _size = static_cast<size_t>(stored.count);
+        map((size - data_offset) / sizeof(Type));
+    } catch (...) {
+        close();
+        throw;
+    }
+}
+
+template<typename Type, typename GrowthPolicy>
+FileBackedList<Type, GrowthPolicy>::~FileBackedList() {
+    close();
+}
+
+template<typename Type, typename GrowthPolicy>
+FileBackedList<Type, GrowthPolicy>::FileBackedList(FileBackedList &&other) noexcept :
+    file(other.file), mapping(other.mapping), data_offset(other.data_offset), values(other.values),
+    _capacity(other._capacity), _size(other._size) {
+    other.file = -1;
+    other.mapping = nullptr;
+    other.values = nullptr;
+    other._capacity = 0;
+    other._size = 0;
+}
+
+template<typename Type, typename GrowthPolicy>
+FileBackedList<Type, GrowthPolicy> &FileBackedList<Type, GrowthPolicy>::operator=(FileBackedList &&other) noexcept {
+    if (this == &other)
+        return *this;
+
+    close();
+    file = other.file;
+    mapping = other.mapping;
+    data_offset = other.data_offset;
+    values = other.values;
+    _capacity = other._capacity;
+    _size = other._size;
+
+    other.file = -1;
+    other.mapping = nullptr;
+    other.values = nullptr;
+    other._capacity = 0;
+    other._size = 0;
+    return *this;
+}
+
+// The element is built before the file grows, since args may refer to an element the growth would move.
+template<typename Type, typename GrowthPolicy>
+template<typename... Args>
+Type &FileBackedList<Type, GrowthPolicy>::emplace_back(Args &&...args) {
+    if (_size == _capacity) {
+        Type value(std::forward<Args>(args)...);
+        reserve(GrowthPolicy::grow(_capacity, _size + 1));
+        return *new (values + _size++) Type(value);
+    }
+    return *new (values + _size++) Type(std::forward<Args>(args)...);
+}
+
+template<typename Type, typename GrowthPolicy>
+void FileBackedList<Type, GrowthPolicy>::pop_back() {
+    if (_size > 0)
+        --_size;
+    lower_count();
+}
+
+template<typename Type, typename GrowthPolicy>
+void FileBackedList<Type, GrowthPolicy>::clear() {
+    _size = 0;
+    lower_count();
+}
+
+template<typename Type, typename GrowthPolicy>
+Type &FileBackedList<Type, GrowthPolicy>::front() {
+    return const_cast<Type &>(static_cast<const FileBackedList &>(*this).front());
+}
+
+template<typename Type, typename GrowthPolicy>
+const Type &FileBackedList<Type, GrowthPolicy>::front() const {
+    if (_size == 0)
+        throw std::out_of_range("List is empty");
+    return values[0];
+}
+
+template<typename Type, typename GrowthPolicy>
+Type &FileBackedList<Type, GrowthPolicy>::back() {
+    return const_cast<Type &>(static_cast<const FileBackedList &>(*this).back());
+}
+
+template<typename Type, typename GrowthPolicy>
+const Type &FileBackedList<Type, GrowthPolicy>::back() const {
+    if (_size == 0)
+        throw std::out_of_range("List is empty");
+    return values[_size - 1];
+}
+
+template<typename Type, typename GrowthPolicy>
+Type &FileBackedList<Type, GrowthPolicy>::at(size_t index) {
+    return const_cast<Type &>(static_cast<const FileBackedList &>(*this).at(index));
+}
+
+template<typename Type, typename GrowthPolicy>
+const Type &FileBackedList<Type, GrowthPolicy>::at(size_t index) const {
+    if (index >= _size)
+        throw std::out_of_range("FileBackedList index out of range");
+    return values[index];
+}
+
+template<typename Type, typename GrowthPolicy>
+void FileBackedList<Type, GrowthPolicy>::reserve(size_t new_capacity) {
+    if (new_capacity <= _capacity)
+        return;
+
+    resize_file(new_capacity);
+    map(new_capacity);
+}
+
+// The count reaches the disk before the file shrinks, so that it never counts elements truncated away, and the
+// mapping shrinks before the file, which must not be accessed past its end.
+template<typename Type, typename GrowthPolicy>
+void FileBackedList<Type, GrowthPolicy>::shrink_to_fit() {
+    if (_size == _capacity)
+        return;
+
+    if (header().count > _size) {
+        header().count = _size;
+        if (::msync(mapping, sizeof(SnapshotHeader), MS_SYNC) != 0)
+            throw std::system_error(errno, std::generic_category(), "Cannot sync FileBackedList");
+    }
+    map(_size);
+    resize_file(_size);
+}
+
+template<typename Type, typename GrowthPolicy>
+void FileBackedList<Type, GrowthPolicy>::sync() {
+    if (::msync(mapping, file_size(_size), MS_SYNC) != 0)
+        throw std::system_error(errno, std::generic_category(), "Cannot sync FileBackedList");
+
+    header().count = _size;
+    if (::msync(mapping, sizeof(SnapshotHeader), MS_SYNC) != 0)
+        throw std::system_error(errno, std::generic_category(), "Cannot sync FileBackedList");
+}
+
+// Written to the mapping only: a process crash keeps it, the page cache outliving the process.
+template<typename Type, typename GrowthPolicy>
+void FileBackedList<Type, GrowthPolicy>::lower_count() {
+    if (header().count > _size)
+        header().count = _size;
+}
+
+template<typename Type, typename GrowthPolicy>
+void FileBackedList<Type, GrowthPolicy>::resize_file(size_t capacity) {
+    if (::ftruncate(file, static_cast<off_t>(file_size(capacity))) != 0)
+        throw std::system_error(errno, std::generic_category(), "Cannot resize FileBackedList");
+}
+
+// Remapping keeps the pages where they are, so that growing never copies an element nor makes them all resident.
+template<typename Type, typename GrowthPolicy>
+void FileBackedList<Type, GrowthPolicy>::map(size_t capacity) {
+    const size_t size = file_size(capacity);
+    void *address;
+    if (mapping == nullptr) {
+        address = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+    } else {
+#ifdef MREMAP_MAYMOVE
+        address = ::mremap(mapping, file_size(_capacity), size, MREMAP_MAYMOVE);
+#else
+        address = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+        if (address != MAP_FAILED)
+            ::munmap(mapping, file_size(_capacity));
+#endif
+    }
+    if (address == MAP_FAILED)
+        throw std::system_error(errno, std::generic_category(), "Cannot map FileBackedList");
+
+    mapping = address;
+    values = reinterpret_cast<Type *>(static_cast<char *>(address) + data_offset);
+    _capacity = capacity;
+}
+
+// Records the count without waiting for the disk: the elements survive the process, but only sync() makes them
+// survive the machine.
+template<typename Type, typename GrowthPolicy>
+void FileBackedList<Type, GrowthPolicy>::close() noexcept {
+    if (mapping != nullptr) {
+        header().count = _size;
+        ::munmap(mapping, file_size(_capacity));
+    }
+    if (file >= 0)
+        ::close(file);
+
+    file = -1;
+    mapping = nullptr;
+    values = nullptr;
+    _capacity = 0;
+    _size = 0;
+}
+
+#endif // FILE_BACKED_LIST_H
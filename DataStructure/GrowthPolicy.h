@@ -0,0 +1,43 @@
+#ifndef GROWTH_POLICY_H
+#define GROWTH_POLICY_H
+
+#include <cstddef>
+
+// Growth policies decide how List resizes its buffer.
+// grow(capacity, required) returns the capacity to reallocate to when required elements no longer fit, and
+// shrink(capacity, size) the capacity to keep once a removal left size elements: returning capacity keeps the buffer.
+
+// Multiplies the capacity by numerator / denominator when full, and halves it once the occupancy falls to
+// 1 / shrink_divisor. The gap between both thresholds is what keeps a list oscillating around a boundary from
+// reallocating on every push and pop. A shrink_divisor of 0 never shrinks.
+template<size_t numerator = 2, size_t denominator = 1, size_t shrink_divisor = 4, size_t minimum_capacity = 8>
+struct GeometricGrowth {
+    static_assert(denominator > 0 && numerator > denominator, "GeometricGrowth needs a factor above 1");
+    static_assert(shrink_divisor == 0 || shrink_divisor > 2, "Halving must leave room before growing again");
+
+    static size_t grow(size_t capacity, size_t required) {
+        size_t grown = capacity / denominator * numerator + capacity % denominator * numerator / denominator;
+        if (grown <= capacity)
+            grown = capacity + 1;
+        if (grown < minimum_capacity)
+            grown = minimum_capacity;
+        return grown < required ? required : grown;
+    }
+
+    static size_t shrink(size_t capacity, size_t size) {
+        if constexpr (shrink_divisor == 0) {
+            return capacity;
+        } else {
+            if (capacity <= minimum_capacity || size > capacity / shrink_divisor)
+                return capacity;
+            return capacity / 2;
+        }
+    }
+};
+
+template<size_t numerator = 2, size_t denominator = 1, size_t minimum_capacity = 8>
+using NeverShrink = GeometricGrowth<numerator, denominator, 0, minimum_capacity>;
+
+using DefaultGrowth = GeometricGrowth<>;
+
+#endif // GROWTH_POLICY_H
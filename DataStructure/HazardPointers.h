@@ -0,0 +1,187 @@
+#ifndef HAZARD_POINTERS_H
+#define HAZARD_POINTERS_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+
+#include "List.h"
+
+// Safe memory reclamation for lock-free structures whose nodes other threads may still be reading once unlinked.
+// A thread publishes the node it is about to read through a Guard, and an unlinked node is retired rather than freed:
+// retired nodes pile up until there are enough of them, then every one no Guard protects is handed to the deleter.
+// Node must have a std::atomic<Node *> next member, which links the retired nodes and which a thread reading a retired
+// node must only load: a node's other members are never read once it has been unlinked.
+template<typename Node>
+class HazardPointers {
+    // One per thread inside a Guard at some point. Records are reused and only freed with the whole domain.
+    struct Record {
+        std::atomic<bool> active{true};
+        std::atomic<Node *> pointer{nullptr};
+        Record *next = nullptr;
+    };
+
+public:
+    HazardPointers() = default;
+    ~HazardPointers();
+
+    HazardPointers(const HazardPointers &other) = delete;
+    HazardPointers &operator=(const HazardPointers &other) = delete;
+
+    // Holds a hazard pointer for as long as it lives. A thread can hold several Guards.
+    class Guard {
+    public:
+        explicit Guard(HazardPointers &domain) : record(domain.acquire()) {}
+        ~Guard() {
+            record->pointer.store(nullptr, std::memory_order_release);
+            record->active.store(false, std::memory_order_release);
+        }
+
+        Guard(const Guard &other) = delete;
+        Guard &operator=(const Guard &other) = delete;
+
+        // Loads source until the node it points to is published before source changes, so that the node cannot be
+        // reclaimed while the Guard protects it, and returns it.
+        Node *protect(const std::atomic<Node *> &source);
+        void clear() { record->pointer.store(nullptr, std::memory_order_release); }
+
+    private:
+        Record *record;
+    };
+
+    // Hands node to deleter once no Guard protects it, at the latest when reclaim() is called.
+    template<typename Deleter>
+    void retire(Node *node, Deleter &&deleter);
+
+    // Hands every retired node to deleter. No thread may be using the structure any more.
+    template<typename Deleter>
+    void reclaim(Deleter &&deleter);
+
+private:
+    Record *acquire();
+    template<typename Deleter>
+    void scan(Deleter &deleter);
+    void push_retired(Node *first, Node *last, size_t count);
+
+    std::atomic<Record *> records{nullptr};
+    std::atomic<size_t> record_count{0};
+    std::atomic<Node *> retired{nullptr};
+    std::atomic<size_t> retired_count{0};
+};
+
+template<typename Node>
+HazardPointers<Node>::~HazardPointers() {
+    Record *record = records.load(std::memory_order_acquire);
+    while (record != nullptr) {
+        Record *next = record->next;
+        delete record;
+        record = next;
+    }
+}
+
+template<typename Node>
+Node *HazardPointers<Node>::Guard::protect(const std::atomic<Node *> &source) {
+    Node *node = source.load();
+    for (;;) {
+        record->pointer.store(node);
+        Node *current = source.load();
+        if (current == node)
+            return node;
+        node = current;
+    }
+}
+
+template<typename Node>
+template<typename Deleter>
+void HazardPointers<Node>::retire(Node *node, Deleter &&deleter) {
+    push_retired(node, node, 1);
+
+    // Scanning costs a pass over the records, so it waits for several times as many retired nodes, most of which
+    // can then be freed.
+    const size_t threshold = 2 * record_count.load(std::memory_order_relaxed) + 64;
+    if (retired_count.load(std::memory_order_relaxed) >= threshold)
+        scan(deleter);
+}
+
+template<typename Node>
+template<typename Deleter>
+void HazardPointers<Node>::reclaim(Deleter &&deleter) {
+    Node *node = retired.exchange(nullptr, std::memory_order_acquire);
+    while (node != nullptr) {
+        Node *next = node->next.load(std::memory_order_relaxed);
+        deleter(node);
+        node = next;
+    }
+    retired_count.store(0, std::memory_order_relaxed);
+}
+
+// A free record is claimed by whichever thread flips its flag first. With none free, a new one is pushed in front of
+// the others, which never move again, so that concurrent scans can walk them without any synchronization.
+template<typename Node>
+typename HazardPointers<Node>::Record *HazardPointers<Node>::acquire() {
+    for (Record *record = records.load(std::memory_order_acquire); record != nullptr; record = record->next) {
+        if (!record->active.load(std::memory_order_relaxed) &&
+            !record->active.exchange(true, std::memory_order_acquire))
+            return record;
+    }
+
+    auto *record = new Record();
+    record->next = records.load(std::memory_order_relaxed);
+    while (!records.compare_exchange_weak(record->next, record, std::memory_order_release, std::memory_order_relaxed))
+        ;
+    record_count.fetch_add(1, std::memory_order_relaxed);
+    return record;
+}
+
+// Takes the whole retired list at once, so concurrent scans never see the same node, then frees the nodes missing from
+// a snapshot of the hazard pointers. A node retired after its removal from the structure cannot be protected anew,
+// so the snapshot, taken after the nodes were retired, is conclusive.
+template<typename Node>
+template<typename Deleter>
+void HazardPointers<Node>::scan(Deleter &deleter) {
+    Node *node = retired.exchange(nullptr);
+    if (node == nullptr)
+        return;
+
+    List<Node *> hazards;
+    for (Record *record = records.load(std::memory_order_acquire); record != nullptr; record = record->next) {
+        Node *pointer = record->pointer.load();
+        if (pointer != nullptr)
+            hazards.push_back(pointer);
+    }
+    std::sort(hazards.begin(), hazards.end());
+
+    Node *kept_first = nullptr;
+    Node *kept_last = nullptr;
+    size_t kept = 0;
+    size_t freed = 0;
+    while (node != nullptr) {
+        Node *next = node->next.load(std::memory_order_relaxed);
+        if (std::binary_search(hazards.begin(), hazards.end(), node)) {
+            node->next.store(kept_first, std::memory_order_relaxed);
+            kept_first = node;
+            if (kept_last == nullptr)
+                kept_last = node;
+            ++kept;
+        } else {
+            deleter(node);
+            ++freed;
+        }
+        node = next;
+    }
+
+    retired_count.fetch_sub(freed + kept, std::memory_order_relaxed);
+    if (kept_first != nullptr)
+        push_retired(kept_first, kept_last, kept);
+}
+
+template<typename Node>
+void HazardPointers<Node>::push_retired(Node *first, Node *last, size_t count) {
+    retired_count.fetch_add(count, std::memory_order_relaxed);
+    Node *head = retired.load(std::memory_order_relaxed);
+    do {
+        last->next.store(head, std::memory_order_relaxed);
+    } while (!retired.compare_exchange_weak(head, first, std::memory_order_release, std::memory_order_relaxed));
+}
+
+#endif // HAZARD_POINTERS_H
@@ -1,116 +1,524 @@
 #ifndef HEAP_H
 #define HEAP_H
 
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "ContainerStats.h"
+#include "GrowthPolicy.h"
+#include "Memory.h"
+
+namespace detail {
+    // Siblings smaller than a cache line are aligned to their own size so that they never straddle two lines, and
+    // larger ones to a cache line so that they span as few as possible. Binary siblings are left alone.
+    constexpr size_t sibling_alignment(size_t arity, size_t element_size) {
+        constexpr size_t cache_line = 64;
+        const size_t sibling_bytes = arity * element_size;
+        if (arity == 2)
+            return 0;
+        if (sibling_bytes <= cache_line)
+            return cache_line % sibling_bytes == 0 ? sibling_bytes : 0;
+        return sibling_bytes % cache_line == 0 && cache_line % element_size == 0 ? cache_line : 0;
+    }
+
+    // The sifts shared by Heap and IndexedHeap, over a heap whose nodes have arity children. Both lift the moving
+    // element out and shift the others into the hole it leaves, so each level costs a single move instead of the three
+    // of a swap, and put it back once its final position is known. placed(element, position) is called for every
+    // element landing on a new position. Both return the final position of the sifted element.
+    template<size_t arity, typename Type, typename Compare, typename Placed>
+    size_t sift_up(Type *values, size_t position, Compare &compare, Placed placed) {
+        Type value = std::move(values[position]);
+        while (position > 0) {
+            const size_t parent = (position - 1) / arity;
+            if (!compare(value, values[parent]))
+                break;
+
+            values[position] = std::move(values[parent]);
+            placed(values[position], position);
+            position = parent;
+        }
+        values[position] = std::move(value);
+        placed(values[position], position);
+        return position;
+    }
+
+    template<size_t arity, typename Type, typename Compare, typename Placed>
+    size_t sift_down(Type *values, size_t size, size_t position, Compare &compare, Placed placed) {
+        Type value = std::move(values[position]);
+        while (true) {
+            const size_t first = position * arity + 1;
+            if (first >= size)
+                break;
+
+            const size_t last = first + arity < size ? first + arity : size;
+            size_t child = first;
+            for (size_t sibling = first + 1; sibling < last; ++sibling) {
+                if (compare(values[sibling], values[child]))
+                    child = sibling;
+            }
+            if (!compare(values[child], value))
+                break;
+
+            values[position] = std::move(values[child]);
+            placed(values[position], position);
+            position = child;
+        }
+        values[position] = std::move(value);
+        placed(values[position], position);
+        return position;
+    }
+
+    // Floyd's construction: every internal node is sifted down starting from the last one, which is O(n) where
+    // inserting the elements one by one would be O(n log n).
+    template<size_t arity, typename Type, typename Compare>
+    void make_heap(Type *values, size_t size, Compare &compare) {
+        for (size_t position = (size + arity - 2) / arity; position > 0; --position)
+            sift_down<arity>(values, size, position - 1, compare, [](const Type &, size_t) {});
+    }
+}
+
+// A heap constructed with a capacity keeps it and throws once full, while a default or range constructed heap grows
+// its storage as needed.
+// Every node has arity children, stored next to each other. A wider heap is shallower, so a pop sifts through fewer
+// levels, and with arity 4 or 8 the children of a node are aligned to share a single cache line when they fit in one.
+// With DATA_STRUCTURE_STATS, stats() also tells how deep its sifts went.
+template<typename Type, typename Comparator = std::less<Type>, typename Allocator = std::allocator<Type>,
+         size_t arity = 2>
+class Heap : private detail::StatsRecorder<> {
+    static_assert(arity >= 2, "A heap node needs at least two children");
+
+    using AllocatorTraits = std::allocator_traits<Allocator>;
 
-template<typename Type, typename Comparator = std::less<Type>>
-class Heap {
 public:
-    explicit Heap(size_t capacity);
-    Heap(size_t capacity, Comparator comparator);
+    explicit Heap(Comparator comparator = Comparator(), const Allocator &allocator = Allocator());
+    explicit Heap(size_t capacity, const Allocator &allocator = Allocator());
+    Heap(size_t capacity, Comparator comparator, const Allocator &allocator = Allocator());
+    template<typename InputIterator, typename = std::enable_if_t<!std::is_integral_v<InputIterator>>>
+    Heap(InputIterator first, InputIterator last, Comparator comparator = Comparator(),
+         const Allocator &allocator = Allocator());
     ~Heap();
 
-    void insert(const Type &value);
+    Heap(const Heap &other);
+    Heap &operator=(const Heap &other);
+
+    Heap(Heap &&other) noexcept;
+    Heap &operator=(Heap &&other) noexcept(AllocatorTraits::propagate_on_container_move_assignment::value ||
+                                           AllocatorTraits::is_always_equal::value);
+
+    void insert(const Type &value) { push(value); }
+    void push(const Type &value);
+    void push(Type &&value);
+    template<typename... Args>
+    void emplace(Args &&...args);
+    // Pushes the count elements starting at first as one batch, which reheapifies everything when the batch is as
+    // large as the heap instead of sifting every element up.
+    template<typename InputIterator>
+    void push_n(InputIterator first, size_t count);
+    // Pushes count elements that fill(storage, count) writes straight into the uninitialized storage past the last
+    // element, as push_n does. When fill throws, nothing is pushed.
+    template<typename Fill>
+    void push_uninitialized(size_t count, Fill fill);
+
     Type &peek() const;
     Type pop();
+    // Pops up to count elements into out, in order, and returns out past the last one written.
+    template<typename OutputIterator>
+    OutputIterator pop_n(size_t count, OutputIterator out);
+    // Replaces the top by value and returns the previous top: a single sift down, where pop then push takes two.
+    Type replace_top(Type value);
 
     [[nodiscard]] bool isEmpty() const { return _size == 0; }
-    [[nodiscard]] bool isFull() const { return _size == capacity; }
+    [[nodiscard]] bool isFull() const { return !growable && _size == capacity; }
     [[nodiscard]] size_t size() const { return _size; }
+    [[nodiscard]] Allocator get_allocator() const { return allocator; }
+    using detail::StatsRecorder<>::stats;
+
+    // The elements in heap order, the top first.
+    const Type *data() const { return values; }
 
 private:
-    static size_t left(const size_t position) { return position * 2 + 1; }
-    static size_t right(const size_t position) { return position * 2 + 2; }
-    static size_t parent(const size_t position) { return (position - 1) / 2; }
+    // Alignment given to each group of siblings, 0 when the group cannot be laid out to touch fewer cache lines.
+    static constexpr size_t sibling_alignment = detail::sibling_alignment(arity, sizeof(Type));
+    // Elements allocated in front of the heap to shift its first sibling group onto such a boundary.
+    static constexpr size_t padding = sibling_alignment / sizeof(Type);
 
-    bool compare(size_t a, size_t b) const;
-    void swap(size_t a, size_t b);
-    void heapify(size_t position = 0);
+    void sift_up(size_t position);
+    void sift_down(size_t position);
+    // The levels between position and its ancestor.
+    static size_t depth_below(size_t ancestor, size_t position);
+    void heapify();
+    // Restores the heap once the elements from old_size on were pushed.
+    void sift_up_pushed(size_t old_size);
+    void reserve_for_push(size_t count);
+    void reallocate(size_t new_capacity);
+    void release() noexcept;
+    void steal(Heap &other) noexcept;
 
+    Type *allocate_buffer(size_t count);
+    void deallocate_buffer(Type *buffer, size_t count) noexcept;
+    static Type *align(Type *buffer);
+
+    Allocator allocator;
+    Type *buffer = nullptr;
     Type *values = nullptr;
     size_t _size = 0;
     size_t capacity = 0;
+    bool growable = true;
     Comparator comparator;
 };
 
-template<typename Type, typename Comparator>
-Heap<Type, Comparator>::Heap(size_t capacity) : capacity(capacity) {
-    values = new Type[capacity];
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+Heap<Type, Comparator, Allocator, arity>::Heap(Comparator comparator, const Allocator &allocator) :
+    allocator(allocator), comparator(comparator) {}
+
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+Heap<Type, Comparator, Allocator, arity>::Heap(size_t capacity, const Allocator &allocator) :
+    allocator(allocator), capacity(capacity), growable(false) {
+    buffer = allocate_buffer(capacity);
+    values = align(buffer);
 }
 
-template<typename Type, typename Comparator>
-Heap<Type, Comparator>::Heap(size_t capacity, Comparator comparator) : capacity(capacity), comparator(comparator) {
-    values = new Type[capacity];
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+Heap<Type, Comparator, Allocator, arity>::Heap(size_t capacity, Comparator comparator, const Allocator &allocator) :
+    allocator(allocator), capacity(capacity), growable(false), comparator(comparator) {
+    buffer = allocate_buffer(capacity);
+    values = align(buffer);
 }
 
-template<typename Type, typename Comparator>
-Heap<Type, Comparator>::~Heap() {
-    delete[] values;
+// The elements are copied as they come, then heapified at once.
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+template<typename InputIterator, typename>
+Heap<Type, Comparator, Allocator, arity>::Heap(InputIterator first, InputIterator last, Comparator comparator,
+                                        const Allocator &allocator) : allocator(allocator), comparator(comparator) {
+    try {
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+                                        typename std::iterator_traits<InputIterator>::iterator_category>) {
+            reallocate(static_cast<size_t>(std::distance(first, last)));
+        }
+
+        for (; first != last; ++first) {
+            if (_size == capacity)
+                reallocate(DefaultGrowth::grow(capacity, _size + 1));
+            new (values + _size) Type(*first);
+            ++_size;
+        }
+    } catch (...) {
+        release();
+        throw;
+    }
+
+    record_copies(_size);
+    heapify();
 }
 
-template<typename Type, typename Comparator>
-void Heap<Type, Comparator>::insert(const Type &value) {
-    if (_size == capacity)
-        throw std::overflow_error("Heap is full");
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+Heap<Type, Comparator, Allocator, arity>::~Heap() {
+    release();
+}
+
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+Heap<Type, Comparator, Allocator, arity>::Heap(const Heap &other) :
+    allocator(AllocatorTraits::select_on_container_copy_construction(other.allocator)), capacity(other.capacity),
+    growable(other.growable), comparator(other.comparator) {
+    buffer = allocate_buffer(capacity);
+    values = align(buffer);
+    try {
+        detail::uninitialized_copy(other.values, other._size, values);
+    } catch (...) {
+        deallocate_buffer(buffer, capacity);
+        throw;
+    }
+    _size = other._size;
+    record_copies(_size);
+}
+
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+Heap<Type, Comparator, Allocator, arity> &Heap<Type, Comparator, Allocator, arity>::operator=(const Heap &other) {
+    if (this == &other)
+        return *this;
+
+    Heap copy(other);
+    *this = std::move(copy);
+    take_stats(copy);
+    return *this;
+}
+
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+Heap<Type, Comparator, Allocator, arity>::Heap(Heap &&other) noexcept :
+    allocator(std::move(other.allocator)), growable(other.growable), comparator(std::move(other.comparator)) {
+    steal(other);
+}
+
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+Heap<Type, Comparator, Allocator, arity> &Heap<Type, Comparator, Allocator, arity>::operator=(Heap &&other) noexcept(
+    AllocatorTraits::propagate_on_container_move_assignment::value || AllocatorTraits::is_always_equal::value) {
+    if (this == &other)
+        return *this;
+
+    release();
+    growable = other.growable;
+    comparator = std::move(other.comparator);
+
+    if constexpr (!AllocatorTraits::propagate_on_container_move_assignment::value &&
+                  !AllocatorTraits::is_always_equal::value) {
+        // other's buffer cannot be released through our allocator, so its elements are moved one by one instead.
+        if (allocator != other.allocator) {
+            buffer = allocate_buffer(other.capacity);
+            values = align(buffer);
+            capacity = other.capacity;
+            detail::relocate(other.values, other._size, values);
+            record_relocation<Type>(other._size);
+            _size = other._size;
+            other._size = 0;
+            other.release();
+            return *this;
+        }
+    }
+
+    if constexpr (AllocatorTraits::propagate_on_container_move_assignment::value)
+        allocator = std::move(other.allocator);
+    steal(other);
+    return *this;
+}
 
-    size_t position = _size++;
-    values[position] = value;
-    while (position > 0 && compare(position, parent(position))) {
-        swap(position, parent(position));
-        position = parent(position);
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+template<typename... Args>
+void Heap<Type, Comparator, Allocator, arity>::emplace(Args &&...args) {
+    if (_size == capacity) {
+        if (!growable)
+            throw std::overflow_error("Heap is full");
+
+        // args may refer to an element, which the reallocation would move away.
+        Type value(std::forward<Args>(args)...);
+        reallocate(DefaultGrowth::grow(capacity, _size + 1));
+        new (values + _size) Type(std::move(value));
+        record_moves(1);
+    } else {
+        new (values + _size) Type(std::forward<Args>(args)...);
+    }
+
+    sift_up(_size++);
+}
+
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+void Heap<Type, Comparator, Allocator, arity>::push(const Type &value) {
+    emplace(value);
+    record_copies(1);
+}
+
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+void Heap<Type, Comparator, Allocator, arity>::push(Type &&value) {
+    emplace(std::move(value));
+    record_moves(1);
+}
+
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+template<typename InputIterator>
+void Heap<Type, Comparator, Allocator, arity>::push_n(InputIterator first, size_t count) {
+    reserve_for_push(count);
+
+    const size_t old_size = _size;
+    try {
+        for (; _size < old_size + count; ++first) {
+            new (values + _size) Type(*first);
+            ++_size;
+        }
+    } catch (...) {
+        for (size_t position = old_size; position < _size; ++position)
+            sift_up(position);
+        record_copies(_size - old_size);
+        throw;
     }
+    record_copies(count);
+    sift_up_pushed(old_size);
 }
 
-template<typename Type, typename Comparator>
-Type &Heap<Type, Comparator>::peek() const {
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+template<typename Fill>
+void Heap<Type, Comparator, Allocator, arity>::push_uninitialized(size_t count, Fill fill) {
+    static_assert(std::is_trivially_copyable_v<Type>, "Only trivially copyable elements can be written as raw bytes");
+    reserve_for_push(count);
+    fill(values + _size, count);
+
+    const size_t old_size = _size;
+    _size += count;
+    sift_up_pushed(old_size);
+}
+
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+Type &Heap<Type, Comparator, Allocator, arity>::peek() const {
     if (_size == 0)
         throw std::out_of_range("Heap is empty");
     return values[0];
 }
 
-template<typename Type, typename Comparator>
-Type Heap<Type, Comparator>::pop() {
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+Type Heap<Type, Comparator, Allocator, arity>::pop() {
     if (_size == 0)
         throw std::out_of_range("Heap is empty");
 
-    Type top = values[0];
-    values[0] = values[--_size];
+    Type top = std::move(values[0]);
+    if (--_size > 0)
+        values[0] = std::move(values[_size]);
+    values[_size].~Type();
+    record_moves(_size > 0 ? 2 : 1);
 
-    heapify(0);
+    if (_size > 1)
+        sift_down(0);
     return top;
 }
 
-template<typename Type, typename Comparator>
-bool Heap<Type, Comparator>::compare(size_t a, size_t b) const {
-    return comparator(values[a], values[b]);
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+template<typename OutputIterator>
+OutputIterator Heap<Type, Comparator, Allocator, arity>::pop_n(size_t count, OutputIterator out) {
+    for (; count > 0 && _size > 0; --count) {
+        *out = pop();
+        ++out;
+    }
+    return out;
 }
 
-template<typename Type, typename Comparator>
-void Heap<Type, Comparator>::swap(size_t a, size_t b) {
-    Type temp = values[a];
-    values[a] = values[b];
-    values[b] = temp;
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+Type Heap<Type, Comparator, Allocator, arity>::replace_top(Type value) {
+    if (_size == 0)
+        throw std::out_of_range("Heap is empty");
+
+    Type top = std::move(values[0]);
+    values[0] = std::move(value);
+    record_moves(2);
+    sift_down(0);
+    return top;
 }
 
-template<typename Type, typename Comparator>
-void Heap<Type, Comparator>::heapify(size_t position) {
-    while (true) {
-        const size_t leftChild = left(position), rightChild = right(position);
-        size_t smallest = position;
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+void Heap<Type, Comparator, Allocator, arity>::sift_up(size_t position) {
+    const size_t final_position = detail::sift_up<arity>(values, position, comparator, [](const Type &, size_t) {});
+    if constexpr (detail::stats_enabled)
+        record_sift(depth_below(final_position, position));
+}
 
-        if (leftChild < _size && compare(leftChild, smallest))
-            smallest = leftChild;
-        if (rightChild < _size && compare(rightChild, smallest))
-            smallest = rightChild;
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+void Heap<Type, Comparator, Allocator, arity>::sift_down(size_t position) {
+    const size_t final_position =
+        detail::sift_down<arity>(values, _size, position, comparator, [](const Type &, size_t) {});
+    if constexpr (detail::stats_enabled)
+        record_sift(depth_below(position, final_position));
+}
+
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+size_t Heap<Type, Comparator, Allocator, arity>::depth_below(size_t ancestor, size_t position) {
+    size_t depth = 0;
+    for (; position > ancestor; ++depth)
+        position = (position - 1) / arity;
+    return depth;
+}
+
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+void Heap<Type, Comparator, Allocator, arity>::heapify() {
+    detail::make_heap<arity>(values, _size, comparator);
+}
+
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+void Heap<Type, Comparator, Allocator, arity>::sift_up_pushed(size_t old_size) {
+    if (_size - old_size >= old_size) {
+        heapify();
+    } else {
+        for (size_t position = old_size; position < _size; ++position)
+            sift_up(position);
+    }
+}
+
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+void Heap<Type, Comparator, Allocator, arity>::reserve_for_push(size_t count) {
+    if (_size + count <= capacity)
+        return;
+    if (!growable)
+        throw std::overflow_error("Heap is full");
+    reallocate(DefaultGrowth::grow(capacity, _size + count));
+}
+
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+void Heap<Type, Comparator, Allocator, arity>::reallocate(size_t new_capacity) {
+    Type *new_buffer = allocate_buffer(new_capacity);
+    Type *new_values = align(new_buffer);
+    try {
+        detail::relocate(values, _size, new_values);
+    } catch (...) {
+        deallocate_buffer(new_buffer, new_capacity);
+        throw;
+    }
+    if (buffer != nullptr)
+        record_reallocation();
+    record_relocation<Type>(_size);
+
+    deallocate_buffer(buffer, capacity);
+    buffer = new_buffer;
+    values = new_values;
+    capacity = new_capacity;
+}
+
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+void Heap<Type, Comparator, Allocator, arity>::release() noexcept {
+    detail::destroy(values, _size);
+    deallocate_buffer(buffer, capacity);
+    buffer = nullptr;
+    values = nullptr;
+    capacity = 0;
+    _size = 0;
+}
+
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+void Heap<Type, Comparator, Allocator, arity>::steal(Heap &other) noexcept {
+    take_memory(other);
+    buffer = other.buffer;
+    values = other.values;
+    capacity = other.capacity;
+    _size = other._size;
+
+    other.buffer = nullptr;
+    other.values = nullptr;
+    other.capacity = 0;
+    other._size = 0;
+}
+
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+Type *Heap<Type, Comparator, Allocator, arity>::allocate_buffer(size_t count) {
+    if (count == 0)
+        return nullptr;
+    Type *new_buffer = detail::allocate(allocator, count + padding);
+    record_allocation((count + padding) * sizeof(Type));
+    return new_buffer;
+}
+
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+void Heap<Type, Comparator, Allocator, arity>::deallocate_buffer(Type *buffer, size_t count) noexcept {
+    if (buffer != nullptr) {
+        detail::deallocate(allocator, buffer, count + padding);
+        record_deallocation((count + padding) * sizeof(Type));
+    }
+}
 
-        if (smallest != position) {
-            swap(position, smallest);
-            position = smallest;
-        } else {
-            break;
+// The children of a node start right after a multiple of arity, so shifting the heap until values + 1 is aligned
+// aligns every sibling group. The allocator only guarantees alignof(Type), so the shift can be impossible, in which
+// case the heap simply starts at the buffer.
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+Type *Heap<Type, Comparator, Allocator, arity>::align(Type *buffer) {
+    if constexpr (padding > 0) {
+        for (size_t shift = 0; buffer != nullptr && shift < padding; ++shift) {
+            if (reinterpret_cast<std::uintptr_t>(buffer + shift + 1) % sibling_alignment == 0)
+                return buffer + shift;
         }
     }
+    return buffer;
 }
 
+// A heap whose nodes have arity children, e.g. DaryHeap<int, 4>.
+template<typename Type, size_t arity, typename Comparator = std::less<Type>, typename Allocator = std::allocator<Type>>
+using DaryHeap = Heap<Type, Comparator, Allocator, arity>;
 
 #endif // HEAP_H
@@ -0,0 +1,53 @@
+#ifndef HEAP_SORT_H
+#define HEAP_SORT_H
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+#include "Heap.h"
+
+// In-place sorts built on the heap sifts, over containers exposing data() and size() such as List, SmallList and
+// Array, e.g. heap::heap_sort(list) or heap::partial_sort(list, 10). Both run in constant extra memory and are not
+// stable.
+namespace heap {
+
+    // Moves the count smallest elements, in order, to the front of the container. The others are left behind in an
+    // unspecified order. Takes O(n log count): the front is kept as a max-heap of the smallest elements seen so far,
+    // whose top is replaced by every smaller element met, and is sorted once the whole container went through it.
+    template<typename Container, typename Comparator = std::less<>>
+    void partial_sort(Container &container, size_t count, Comparator comparator = Comparator()) {
+        auto *values = container.data();
+        const size_t size = container.size();
+        if (count > size)
+            count = size;
+        if (count == 0)
+            return;
+
+        auto reversed = [&comparator](const auto &a, const auto &b) { return comparator(b, a); };
+        auto ignored = [](const auto &, size_t) {};
+        using std::swap;
+
+        detail::make_heap<2>(values, count, reversed);
+        for (size_t index = count; index < size; ++index) {
+            if (comparator(values[index], values[0])) {
+                swap(values[index], values[0]);
+                detail::sift_down<2>(values, count, 0, reversed, ignored);
+            }
+        }
+
+        for (size_t end = count - 1; end > 0; --end) {
+            swap(values[0], values[end]);
+            detail::sift_down<2>(values, end, 0, reversed, ignored);
+        }
+    }
+
+    // Sorts the container in O(n log n), whatever the input.
+    template<typename Container, typename Comparator = std::less<>>
+    void heap_sort(Container &container, Comparator comparator = Comparator()) {
+        heap::partial_sort(container, container.size(), comparator);
+    }
+
+} // namespace heap
+
+#endif // HEAP_SORT_H
@@ -0,0 +1,282 @@
+#ifndef INDEXED_HEAP_H
+#define INDEXED_HEAP_H
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "ContainerStats.h"
+#include "Heap.h"
+#include "List.h"
+
+// A heap whose elements stay reachable once inserted: insert returns a handle through which the element can be read,
+// given a new priority or erased in O(log n). This spares shortest-path searches and schedulers from pushing duplicates
+// and skipping the stale ones when a priority changes.
+// A handle stays valid until its element leaves the heap, after which it may be handed out again by a later insert.
+template<typename Type, typename Comparator = std::less<Type>, typename Allocator = std::allocator<Type>,
+         size_t arity = 2>
+class IndexedHeap : private detail::StatsRecorder<> {
+public:
+    using Handle = size_t;
+
+    explicit IndexedHeap(Comparator comparator = Comparator(), const Allocator &allocator = Allocator());
+
+    // Written out so that a copy starts its stats over, as the other containers do, instead of copying them.
+    IndexedHeap(const IndexedHeap &other);
+    IndexedHeap &operator=(const IndexedHeap &other);
+    IndexedHeap(IndexedHeap &&other) noexcept;
+    IndexedHeap &operator=(IndexedHeap &&other) noexcept(
+        std::is_nothrow_move_assignable_v<List<Entry, EntryAllocator>>);
+
+    Handle insert(const Type &value) { return push(value); }
+    Handle push(const Type &value);
+    Handle push(Type &&value);
+    template<typename... Args>
+    Handle emplace(Args &&...args);
+
+    const Type &peek() const;
+    Handle top() const;
+    Type pop();
+
+    const Type &get(Handle handle) const { return entries[position_of(handle)].value; }
+    [[nodiscard]] bool contains(Handle handle) const;
+
+    // decrease_key only moves the element towards the top and increase_key away from it, each throwing
+    // invalid_argument when the new value goes the other way. update accepts either direction.
+    void decrease_key(Handle handle, Type value);
+    void increase_key(Handle handle, Type value);
+    void update(Handle handle, Type value);
+    void erase(Handle handle);
+
+    [[nodiscard]] bool isEmpty() const { return entries.is_empty(); }
+    [[nodiscard]] size_t size() const { return entries.size(); }
+    // The buffers of the elements and of the handle index, along with the elements copied and moved. The handles
+    // copied into the index are left out.
+    [[nodiscard]] ContainerStats stats() const;
+
+private:
+    struct Entry {
+        template<typename... Args>
+        explicit Entry(Handle handle, Args &&...args) : value(std::forward<Args>(args)...), handle(handle) {}
+
+        Type value;
+        Handle handle;
+    };
+
+    using EntryAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Entry>;
+    using HandleAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Handle>;
+
+    // Position recorded for the handles whose element left the heap.
+    static constexpr size_t removed = static_cast<size_t>(-1);
+
+    size_t position_of(Handle handle) const;
+    size_t sift_up(size_t position);
+    size_t sift_down(size_t position);
+    void remove_at(size_t position);
+
+    List<Entry, EntryAllocator> entries;
+    List<size_t, HandleAllocator> positions;
+    List<Handle, HandleAllocator> free_handles;
+    Comparator comparator;
+};
+
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+IndexedHeap<Type, Comparator, Allocator, arity>::IndexedHeap(Comparator comparator, const Allocator &allocator) :
+    entries(EntryAllocator(allocator)), positions(HandleAllocator(allocator)), free_handles(HandleAllocator(allocator)),
+    comparator(comparator) {}
+
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+IndexedHeap<Type, Comparator, Allocator, arity>::IndexedHeap(const IndexedHeap &other) :
+    entries(other.entries), positions(other.positions), free_handles(other.free_handles),
+    comparator(other.comparator) {}
+
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+IndexedHeap<Type, Comparator, Allocator, arity> &
+IndexedHeap<Type, Comparator, Allocator, arity>::operator=(const IndexedHeap &other) {
+    if (this == &other)
+        return *this;
+
+    entries = other.entries;
+    positions = other.positions;
+    free_handles = other.free_handles;
+    comparator = other.comparator;
+    return *this;
+}
+
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+IndexedHeap<Type, Comparator, Allocator, arity>::IndexedHeap(IndexedHeap &&other) noexcept :
+    entries(std::move(other.entries)), positions(std::move(other.positions)),
+    free_handles(std::move(other.free_handles)), comparator(std::move(other.comparator)) {}
+
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+IndexedHeap<Type, Comparator, Allocator, arity> &IndexedHeap<Type, Comparator, Allocator, arity>::operator=(
+    IndexedHeap &&other) noexcept(std::is_nothrow_move_assignable_v<List<Entry, EntryAllocator>>) {
+    if (this == &other)
+        return *this;
+
+    entries = std::move(other.entries);
+    positions = std::move(other.positions);
+    free_handles = std::move(other.free_handles);
+    comparator = std::move(other.comparator);
+    return *this;
+}
+
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+typename IndexedHeap<Type, Comparator, Allocator, arity>::Handle
+IndexedHeap<Type, Comparator, Allocator, arity>::push(const Type &value) {
+    const Handle handle = emplace(value);
+    record_copies(1);
+    return handle;
+}
+
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+typename IndexedHeap<Type, Comparator, Allocator, arity>::Handle
+IndexedHeap<Type, Comparator, Allocator, arity>::push(Type &&value) {
+    const Handle handle = emplace(std::move(value));
+    record_moves(1);
+    return handle;
+}
+
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+template<typename... Args>
+typename IndexedHeap<Type, Comparator, Allocator, arity>::Handle
+IndexedHeap<Type, Comparator, Allocator, arity>::emplace(Args &&...args) {
+    const bool recycled = !free_handles.is_empty();
+    Handle handle;
+    if (recycled) {
+        handle = free_handles.back();
+    } else {
+        handle = positions.size();
+        positions.push_back(removed);
+    }
+
+    entries.emplace_back(handle, std::forward<Args>(args)...);
+    if (recycled)
+        free_handles.pop_back();
+
+    sift_up(entries.size() - 1);
+    return handle;
+}
+
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+const Type &IndexedHeap<Type, Comparator, Allocator, arity>::peek() const {
+    if (entries.is_empty())
+        throw std::out_of_range("Heap is empty");
+    return entries[0].value;
+}
+
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+typename IndexedHeap<Type, Comparator, Allocator, arity>::Handle
+IndexedHeap<Type, Comparator, Allocator, arity>::top() const {
+    if (entries.is_empty())
+        throw std::out_of_range("Heap is empty");
+    return entries[0].handle;
+}
+
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+Type IndexedHeap<Type, Comparator, Allocator, arity>::pop() {
+    if (entries.is_empty())
+        throw std::out_of_range("Heap is empty");
+
+    Type top = std::move(entries[0].value);
+    record_moves(1);
+    remove_at(0);
+    return top;
+}
+
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+bool IndexedHeap<Type, Comparator, Allocator, arity>::contains(Handle handle) const {
+    return handle < positions.size() && positions[handle] != removed;
+}
+
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+void IndexedHeap<Type, Comparator, Allocator, arity>::decrease_key(Handle handle, Type value) {
+    const size_t position = position_of(handle);
+    if (comparator(entries[position].value, value))
+        throw std::invalid_argument("decrease_key would move the element away from the top");
+
+    entries[position].value = std::move(value);
+    record_moves(1);
+    sift_up(position);
+}
+
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+void IndexedHeap<Type, Comparator, Allocator, arity>::increase_key(Handle handle, Type value) {
+    const size_t position = position_of(handle);
+    if (comparator(value, entries[position].value))
+        throw std::invalid_argument("increase_key would move the element towards the top");
+
+    entries[position].value = std::move(value);
+    record_moves(1);
+    sift_down(position);
+}
+
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+void IndexedHeap<Type, Comparator, Allocator, arity>::update(Handle handle, Type value) {
+    const size_t position = position_of(handle);
+    entries[position].value = std::move(value);
+    record_moves(1);
+    if (sift_up(position) == position)
+        sift_down(position);
+}
+
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+void IndexedHeap<Type, Comparator, Allocator, arity>::erase(Handle handle) {
+    remove_at(position_of(handle));
+}
+
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+ContainerStats IndexedHeap<Type, Comparator, Allocator, arity>::stats() const {
+    ContainerStats stats = detail::StatsRecorder<>::stats();
+    stats += entries.stats();
+    for (ContainerStats index: {positions.stats(), free_handles.stats()}) {
+        index.copies = index.moves = 0;
+        stats += index;
+    }
+    return stats;
+}
+
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+size_t IndexedHeap<Type, Comparator, Allocator, arity>::position_of(Handle handle) const {
+    if (!contains(handle))
+        throw std::out_of_range("Invalid heap handle");
+    return positions[handle];
+}
+
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+size_t IndexedHeap<Type, Comparator, Allocator, arity>::sift_up(size_t position) {
+    auto compare = [this](const Entry &a, const Entry &b) { return comparator(a.value, b.value); };
+    auto placed = [this](const Entry &entry, size_t moved_to) { positions[entry.handle] = moved_to; };
+    return detail::sift_up<arity>(entries.data(), position, compare, placed);
+}
+
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+size_t IndexedHeap<Type, Comparator, Allocator, arity>::sift_down(size_t position) {
+    auto compare = [this](const Entry &a, const Entry &b) { return comparator(a.value, b.value); };
+    auto placed = [this](const Entry &entry, size_t moved_to) { positions[entry.handle] = moved_to; };
+    return detail::sift_down<arity>(entries.data(), entries.size(), position, compare, placed);
+}
+
+// The last element fills the hole, then moves whichever way its value calls for.
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+void IndexedHeap<Type, Comparator, Allocator, arity>::remove_at(size_t position) {
+    const Handle handle = entries[position].handle;
+    const size_t last = entries.size() - 1;
+    if (position != last) {
+        entries[position] = std::move(entries[last]);
+        positions[entries[position].handle] = position;
+        record_moves(1);
+    }
+    entries.pop_back();
+
+    positions[handle] = removed;
+    free_handles.push_back(handle);
+
+    if (position < entries.size() && sift_up(position) == position)
+        sift_down(position);
+}
+
+#endif // INDEXED_HEAP_H
@@ -0,0 +1,190 @@
+#ifndef INTRUSIVE_LIST_H
+#define INTRUSIVE_LIST_H
+
+#include <cstddef>
+
+// The links an object needs to be part of an IntrusiveList, inherited by its class. An object can be part of several
+// lists at once by inheriting one hook per list, told apart by their Tag:
+//     struct Task : IntrusiveListHook<ReadyTag>, IntrusiveListHook<TimerTag> { ... };
+// Copying an object does not copy its links: the copy is not part of any list.
+template<typename Tag = void>
+class IntrusiveListHook {
+public:
+    IntrusiveListHook() = default;
+    IntrusiveListHook(const IntrusiveListHook &) {}
+    IntrusiveListHook &operator=(const IntrusiveListHook &) { return *this; }
+
+    [[nodiscard]] bool is_linked() const { return next != nullptr; }
+
+private:
+    IntrusiveListHook *previous = nullptr;
+    IntrusiveListHook *next = nullptr;
+
+    template<typename, typename>
+    friend class IntrusiveList;
+};
+
+// A doubly linked list of objects owned elsewhere, whose nodes are the objects themselves through their
+// IntrusiveListHook: linking and unlinking an object only rewires pointers, without allocating or copying anything,
+// and an object can be unlinked in O(1) from a reference to it, wherever it is in the list.
+// The list never owns its objects: it unlinks them when it is cleared or destroyed, and an object must be removed
+// from its lists before it is destroyed or moved to another address.
+template<typename Type, typename Tag = void>
+class IntrusiveList {
+    using Hook = IntrusiveListHook<Tag>;
+
+public:
+    IntrusiveList() { sentinel.previous = sentinel.next = &sentinel; }
+    ~IntrusiveList() noexcept { clear(); }
+
+    IntrusiveList(const IntrusiveList &other) = delete;
+    IntrusiveList &operator=(const IntrusiveList &other) = delete;
+    IntrusiveList(IntrusiveList &&other) noexcept : IntrusiveList() { take_objects(other); }
+    IntrusiveList &operator=(IntrusiveList &&other) noexcept;
+
+    template<typename TypeConstness>
+    struct IteratorTemplate {
+        explicit IteratorTemplate(Hook *hook) : current(hook) {}
+
+        TypeConstness &operator*() const { return static_cast<TypeConstness &>(*current); }
+        TypeConstness *operator->() const { return static_cast<TypeConstness *>(current); }
+
+        IteratorTemplate &operator++() {
+            current = current->next;
+            return *this;
+        }
+
+        IteratorTemplate &operator--() {
+            current = current->previous;
+            return *this;
+        }
+
+        bool operator==(const IteratorTemplate &other) const { return other.current == current; }
+        bool operator!=(const IteratorTemplate &other) const { return other.current != current; }
+
+    private:
+        Hook *current;
+
+        friend class IntrusiveList;
+    };
+
+    using Iterator = IteratorTemplate<Type>;
+    using ConstIterator = IteratorTemplate<const Type>;
+
+    // object must not be part of a list through this hook already.
+    void push_front(Type &object) { insert(begin(), object); }
+    void push_back(Type &object) { insert(end(), object); }
+
+    void pop_front();
+    void pop_back();
+
+    Type &front() { return static_cast<Type &>(*sentinel.next); }
+    const Type &front() const { return static_cast<const Type &>(*sentinel.next); }
+
+    Type &back() { return static_cast<Type &>(*sentinel.previous); }
+    const Type &back() const { return static_cast<const Type &>(*sentinel.previous); }
+
+    // Links object before position and returns an iterator to it.
+    Iterator insert(const Iterator &position, Type &object);
+    // Unlinks the object iterator points to and returns an iterator to the next one.
+    Iterator erase(const Iterator &iterator);
+    // Unlinks object, which must be part of this list.
+    void remove(Type &object) { erase(iterator_to(object)); }
+
+    // An iterator to object, which must be part of this list.
+    Iterator iterator_to(Type &object) { return Iterator(static_cast<Hook *>(&object)); }
+
+    void clear();
+
+    [[nodiscard]] bool is_empty() const { return _size == 0; }
+    [[nodiscard]] size_t size() const { return _size; }
+
+    Iterator begin() { return Iterator(sentinel.next); }
+    Iterator end() { return Iterator(&sentinel); }
+    ConstIterator begin() const { return ConstIterator(sentinel.next); }
+    ConstIterator end() const { return ConstIterator(const_cast<Hook *>(&sentinel)); }
+    ConstIterator cbegin() const { return begin(); }
+    ConstIterator cend() const { return end(); }
+
+private:
+    void take_objects(IntrusiveList &other) noexcept;
+
+    // Closes the ring, linked to itself while the list is empty.
+    Hook sentinel;
+    size_t _size = 0;
+};
+
+template<typename Type, typename Tag>
+IntrusiveList<Type, Tag> &IntrusiveList<Type, Tag>::operator=(IntrusiveList &&other) noexcept {
+    if (this == &other)
+        return *this;
+
+    clear();
+    take_objects(other);
+    return *this;
+}
+
+template<typename Type, typename Tag>
+void IntrusiveList<Type, Tag>::pop_front() {
+    if (!is_empty())
+        erase(begin());
+}
+
+template<typename Type, typename Tag>
+void IntrusiveList<Type, Tag>::pop_back() {
+    if (!is_empty())
+        erase(Iterator(sentinel.previous));
+}
+
+template<typename Type, typename Tag>
+typename IntrusiveList<Type, Tag>::Iterator IntrusiveList<Type, Tag>::insert(const Iterator &position, Type &object) {
+    Hook *hook = static_cast<Hook *>(&object);
+    Hook *next = position.current;
+    hook->previous = next->previous;
+    hook->next = next;
+    next->previous->next = hook;
+    next->previous = hook;
+    _size++;
+    return Iterator(hook);
+}
+
+template<typename Type, typename Tag>
+typename IntrusiveList<Type, Tag>::Iterator IntrusiveList<Type, Tag>::erase(const Iterator &iterator) {
+    Hook *hook = iterator.current;
+    Hook *next = hook->next;
+    hook->previous->next = next;
+    next->previous = hook->previous;
+    hook->previous = hook->next = nullptr;
+    _size--;
+    return Iterator(next);
+}
+
+template<typename Type, typename Tag>
+void IntrusiveList<Type, Tag>::clear() {
+    Hook *current = sentinel.next;
+    while (current != &sentinel) {
+        Hook *next = current->next;
+        current->previous = current->next = nullptr;
+        current = next;
+    }
+
+    sentinel.previous = sentinel.next = &sentinel;
+    _size = 0;
+}
+
+// The first and last objects point to other's sentinel, which this list's sentinel replaces.
+template<typename Type, typename Tag>
+void IntrusiveList<Type, Tag>::take_objects(IntrusiveList &other) noexcept {
+    _size = other._size;
+    if (_size == 0)
+        return;
+
+    sentinel.next = other.sentinel.next;
+    sentinel.previous = other.sentinel.previous;
+    sentinel.next->previous = sentinel.previous->next = &sentinel;
+
+    other.sentinel.previous = other.sentinel.next = &other.sentinel;
+    other._size = 0;
+}
+
+#endif // INTRUSIVE_LIST_H
@@ -1,21 +1,36 @@
 #ifndef LINKEDLIST_H
 #define LINKEDLIST_H
 
-
-template<typename Type>
-class LinkedList {
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "ContainerStats.h"
+#include "NodePool.h"
+
+// Nodes come from a NodePool owned by the list, which obtains them by chunks from Allocator rebound to the node type
+// and recycles the removed ones: pushes and pops rarely reach the allocator, and nodes pushed one after the other end
+// up next to each other in memory, which traversals benefit from. The pool's memory is given back by clear() and by
+// the destructor. Lists sharing nodes memory can all allocate from the same PoolResource through std::pmr.
+template<typename Type, typename Allocator = std::allocator<Type>>
+class LinkedList : private detail::StatsRecorder<> {
 public:
     LinkedList() = default;
+    explicit LinkedList(const Allocator &allocator) : pool(NodeAllocator(allocator)) {}
     ~LinkedList() noexcept { clear(); }
 
     LinkedList(const LinkedList &other) = delete;
     LinkedList &operator=(const LinkedList &other) = delete;
     LinkedList(LinkedList &&other) noexcept;
-    LinkedList &operator=(LinkedList &&other) noexcept;
+    LinkedList &operator=(LinkedList &&other) noexcept(
+        std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value ||
+        std::allocator_traits<Allocator>::is_always_equal::value);
 
 private:
     struct Node {
-        explicit Node(Type value, Node *next = nullptr) : value(value), next(next) {}
+        template<typename... Args>
+        explicit Node(Node *next, Args &&...args) : value(std::forward<Args>(args)...), next(next) {}
         Type value;
         Node *next = nullptr;
     };
@@ -63,6 +78,9 @@ public:
 
     [[nodiscard]] bool is_empty() const;
     [[nodiscard]] size_t size() const;
+    [[nodiscard]] Allocator get_allocator() const { return Allocator(pool.get_allocator()); }
+    // The pool's chunks along with the values copied into nodes.
+    [[nodiscard]] ContainerStats stats() const;
 
     Iterator begin() { return Iterator(head); }
     Iterator end() { return Iterator(nullptr); }
@@ -72,23 +90,51 @@ public:
     ConstIterator cend() const { return ConstIterator(nullptr); }
 
 private:
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using NodeAllocatorTraits = std::allocator_traits<NodeAllocator>;
+
+    // Records the copy or the move of value into the node.
+    template<typename Value>
+    Node *create_node(Node *next, Value &&value);
+    void destroy_node(Node *node) noexcept;
+
+    NodePool<Node, NodeAllocator> pool;
     Node *head = nullptr;
     Node *tail = nullptr;
     size_t _size = 0;
 };
 
-template<typename Type>
-LinkedList<Type>::LinkedList(LinkedList &&other) noexcept : head(other.head), tail(other.tail), _size(other._size) {
+template<typename Type, typename Allocator>
+LinkedList<Type, Allocator>::LinkedList(LinkedList &&other) noexcept :
+    pool(std::move(other.pool)), head(other.head), tail(other.tail), _size(other._size) {
     other.head = other.tail = nullptr;
     other._size = 0;
 }
 
-template<typename Type>
-LinkedList<Type> &LinkedList<Type>::operator=(LinkedList &&other) noexcept {
+template<typename Type, typename Allocator>
+LinkedList<Type, Allocator> &LinkedList<Type, Allocator>::operator=(LinkedList &&other) noexcept(
+    std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value ||
+    std::allocator_traits<Allocator>::is_always_equal::value) {
     if (this == &other)
         return *this;
 
     clear();
+    if constexpr (NodeAllocatorTraits::propagate_on_container_move_assignment::value) {
+        pool = std::move(other.pool);
+    } else {
+        if constexpr (!NodeAllocatorTraits::is_always_equal::value) {
+            // other's nodes cannot be released through our allocator, so its values are copied into new nodes instead.
+            if (pool.get_allocator() != other.pool.get_allocator()) {
+                for (const Type &value: other)
+                    push_back(value);
+                record_copies(other._size);
+                other.clear();
+                return *this;
+            }
+        }
+        pool.splice(other.pool);
+    }
+
     head = other.head;
     tail = other.tail;
     _size = other._size;
@@ -100,9 +146,9 @@ LinkedList<Type> &LinkedList<Type>::operator=(LinkedList &&other) noexcept {
     return *this;
 }
 
-template<typename Type>
-void LinkedList<Type>::push_front(Type value) {
-    auto node = new Node(value, head);
+template<typename Type, typename Allocator>
+void LinkedList<Type, Allocator>::push_front(Type value) {
+    Node *node = create_node(head, std::move(value));
     if (is_empty()) {
         head = tail = node;
     } else {
@@ -111,19 +157,19 @@ void LinkedList<Type>::push_front(Type value) {
     _size++;
 }
 
-template<typename Type>
-void LinkedList<Type>::push_back(Type value) {
+template<typename Type, typename Allocator>
+void LinkedList<Type, Allocator>::push_back(Type value) {
     if (is_empty()) {
-        tail = head = new Node(value);
+        tail = head = create_node(nullptr, std::move(value));
     } else {
-        tail->next = new Node(value);
+        tail->next = create_node(nullptr, std::move(value));
         tail = tail->next;
     }
     _size++;
 }
 
-template<typename Type>
-void LinkedList<Type>::pop_front() {
+template<typename Type, typename Allocator>
+void LinkedList<Type, Allocator>::pop_front() {
     if (is_empty())
         return;
 
@@ -132,15 +178,15 @@ void LinkedList<Type>::pop_front() {
     if (head == nullptr)
         tail = nullptr;
 
-    delete temp;
+    destroy_node(temp);
     _size--;
 }
 
-template<typename Type>
-void LinkedList<Type>::insert_at(const Iterator &iterator, Type value) {
+template<typename Type, typename Allocator>
+void LinkedList<Type, Allocator>::insert_at(const Iterator &iterator, Type value) {
     Node *current = iterator.current;
 
-    Node *new_node = new Node(value, current->next);
+    Node *new_node = create_node(current->next, std::move(value));
     current->next = new_node;
 
     if (tail == current)
@@ -148,8 +194,8 @@ void LinkedList<Type>::insert_at(const Iterator &iterator, Type value) {
     _size++;
 }
 
-template<typename Type>
-void LinkedList<Type>::remove(const Iterator &iterator) {
+template<typename Type, typename Allocator>
+void LinkedList<Type, Allocator>::remove(const Iterator &iterator) {
     Node *removed = iterator.current;
 
     if (removed == head) {
@@ -159,41 +205,75 @@ void LinkedList<Type>::remove(const Iterator &iterator) {
 
     Node *current = head;
     while (current != nullptr) {
-        if (current.next != removed) {
+        if (current->next != removed) {
             current = current->next;
+            continue;
         }
 
-        current.next = removed->next;
-        delete removed;
-        --size;
+        current->next = removed->next;
+        if (tail == removed)
+            tail = current;
+        destroy_node(removed);
+        --_size;
         return;
     }
 }
 
-template<typename Type>
-void LinkedList<Type>::clear() {
+template<typename Type, typename Allocator>
+void LinkedList<Type, Allocator>::clear() {
     Node *current = head;
 
     while (current != nullptr) {
         Node *temp = current;
         current = current->next;
-        delete temp;
+        destroy_node(temp);
     }
 
     head = nullptr;
     tail = nullptr;
     _size = 0;
+    pool.release();
 }
 
-template<typename Type>
-bool LinkedList<Type>::is_empty() const {
+template<typename Type, typename Allocator>
+bool LinkedList<Type, Allocator>::is_empty() const {
     return head == nullptr;
 }
 
-template<typename Type>
-size_t LinkedList<Type>::size() const {
+template<typename Type, typename Allocator>
+size_t LinkedList<Type, Allocator>::size() const {
     return _size;
 }
 
+template<typename Type, typename Allocator>
+ContainerStats LinkedList<Type, Allocator>::stats() const {
+    ContainerStats stats = detail::StatsRecorder<>::stats();
+    stats += pool.stats();
+    return stats;
+}
+
+template<typename Type, typename Allocator>
+template<typename Value>
+typename LinkedList<Type, Allocator>::Node *LinkedList<Type, Allocator>::create_node(Node *next, Value &&value) {
+    Node *node = pool.allocate();
+    try {
+        new (node) Node(next, std::forward<Value>(value));
+    } catch (...) {
+        pool.deallocate(node);
+        throw;
+    }
+    if constexpr (std::is_lvalue_reference_v<Value>)
+        record_copies(1);
+    else
+        record_moves(1);
+    return node;
+}
+
+template<typename Type, typename Allocator>
+void LinkedList<Type, Allocator>::destroy_node(Node *node) noexcept {
+    node->~Node();
+    pool.deallocate(node);
+}
+
 
 #endif // LINKEDLIST_H
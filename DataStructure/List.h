@@ -1,26 +1,75 @@
 #ifndef LIST_H
 #define LIST_H
 
+#include <algorithm>
+#include <iterator>
+#include <memory>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "ContainerStats.h"
+#include "ContiguousIterator.h"
+#include "GrowthPolicy.h"
+#include "Memory.h"
+
+namespace detail {
+
+    // Forward iterators can be walked twice, so a range can be measured before its elements are copied.
+    template<typename Iterator, typename = void>
+    constexpr bool is_forward_iterator_v = false;
+
+    template<typename Iterator>
+    constexpr bool is_forward_iterator_v<
+        Iterator, std::void_t<typename std::iterator_traits<Iterator>::iterator_category>> =
+        std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category>;
+
+} // namespace detail
+
+// Any std::allocator_traits compatible allocator can be used, including std::pmr::polymorphic_allocator to place the
+// list in one of the resources of MemoryResource.h. GrowthPolicy decides when the buffer grows and shrinks,
+// see GrowthPolicy.h. With DATA_STRUCTURE_STATS, stats() tells how it used memory, see ContainerStats.h.
+template<typename Type, typename Allocator = std::allocator<Type>, typename GrowthPolicy = DefaultGrowth>
+class List : private detail::StatsRecorder<> {
+    using AllocatorTraits = std::allocator_traits<Allocator>;
 
-template<typename Type>
-class List {
 public:
-    List();
+    using detail::StatsRecorder<>::stats;
+
+    List() = default;
+    explicit List(const Allocator &allocator) : allocator(allocator) {}
     ~List();
 
     List(const List &other);
     List &operator=(const List &other);
 
     List(List &&other) noexcept;
-    List &operator=(List &&other) noexcept;
+    List &operator=(List &&other) noexcept(AllocatorTraits::propagate_on_container_move_assignment::value ||
+                                           AllocatorTraits::is_always_equal::value);
 
     void push_back(const Type &value);
+    void push_back(Type &&value);
+    template<typename... Args>
+    Type &emplace_back(Args &&...args);
     void pop_back();
 
     void push_front(const Type &value);
+    void push_front(Type &&value);
+    template<typename... Args>
+    Type &emplace_front(Args &&...args);
     void pop_front();
 
+    template<typename InputIterator>
+    void append(InputIterator first, InputIterator last);
+    // Appends count elements that fill(storage, count) writes straight into the uninitialized storage past the last
+    // element, such as bytes read from a file, without first constructing them. When fill throws, nothing is appended.
+    template<typename Fill>
+    void append_uninitialized(size_t count, Fill fill);
+    template<typename InputIterator>
+    void insert(size_t index, InputIterator first, InputIterator last);
+    void erase(size_t index);
+    void erase(size_t first, size_t last);
+
     Type &front();
     const Type &front() const;
     Type &back();
@@ -29,51 +78,25 @@ public:
     Type &at(size_t index);
     const Type &at(size_t index) const;
 
+    void reserve(size_t new_capacity);
+    void resize(size_t new_size);
+    void resize(size_t new_size, const Type &value);
+    void shrink_to_fit();
+
     void clear();
     [[nodiscard]] size_t size() const;
+    [[nodiscard]] size_t capacity() const { return _capacity; }
     [[nodiscard]] bool is_empty() const;
+    [[nodiscard]] Allocator get_allocator() const { return allocator; }
 
     Type &operator[](size_t index) { return values[index]; }
     const Type &operator[](size_t index) const { return values[index]; }
 
-    template<typename TypeConstness>
-    class IteratorTemplate {
-    public:
-        IteratorTemplate(TypeConstness *data_ptr, size_t index) : data(data_ptr), index(index) {}
-
-        TypeConstness &operator*() const { return data[index]; }
-        TypeConstness *operator->() const { return &data[index]; }
-
-        IteratorTemplate &operator++() {
-            ++index;
-            return *this;
-        }
-
-        IteratorTemplate &operator--() {
-            --index;
-            return *this;
-        }
-
-        IteratorTemplate &operator+=(size_t increment) {
-            index += increment;
-            return *this;
-        }
-
-        IteratorTemplate &operator-=(size_t increment) {
-            index -= increment;
-            return *this;
-        }
-
-        bool operator!=(const IteratorTemplate &other) const { return index != other.index; }
-        bool operator==(const IteratorTemplate &other) const { return index == other.index; }
+    Type *data() { return values; }
+    const Type *data() const { return values; }
 
-    private:
-        TypeConstness *data;
-        size_t index;
-    };
-
-    using Iterator = IteratorTemplate<Type>;
-    using ConstIterator = IteratorTemplate<const Type>;
+    using Iterator = ContiguousIterator<Type>;
+    using ConstIterator = ContiguousIterator<const Type>;
 
     Iterator begin() { return Iterator(values, 0); }
     Iterator end() { return Iterator(values, _size); }
@@ -83,184 +106,431 @@ public:
     ConstIterator cend() const { return ConstIterator(values, _size); }
 
 private:
+    [[nodiscard]] size_t grown_capacity(size_t required) const { return GrowthPolicy::grow(_capacity, required); }
+    void reserve_for(size_t required);
+    void shrink_if_sparse();
     void reallocate(size_t new_capacity);
+    Type *allocate_values(size_t count);
+    void deallocate_values(Type *buffer, size_t count) noexcept;
 
+    Allocator allocator;
     Type *values = nullptr;
-    size_t capacity = 8;
+    size_t _capacity = 0;
     size_t _size = 0;
 };
 
-template<typename Type>
-List<Type>::List() {
-    values = new Type[capacity];
-}
-
-template<typename Type>
-List<Type>::~List() {
-    delete[] values;
+template<typename Type, typename Allocator, typename GrowthPolicy>
+List<Type, Allocator, GrowthPolicy>::~List() {
+    detail::destroy(values, _size);
+    deallocate_values(values, _capacity);
 }
 
-template<typename Type>
-List<Type>::List(const List &other) : values(nullptr), capacity(other.capacity), _size(other._size) {
-    values = new Type[capacity];
-    for (size_t i = 0; i < _size; ++i)
-        values[i] = other.values[i];
+template<typename Type, typename Allocator, typename GrowthPolicy>
+List<Type, Allocator, GrowthPolicy>::List(const List &other) :
+    allocator(AllocatorTraits::select_on_container_copy_construction(other.allocator)), _capacity(other._capacity),
+    _size(other._size) {
+    values = allocate_values(_capacity);
+    try {
+        detail::uninitialized_copy(other.values, _size, values);
+    } catch (...) {
+        deallocate_values(values, _capacity);
+        throw;
+    }
+    record_copies(_size);
 }
 
-template<typename Type>
-List<Type> &List<Type>::operator=(const List &other) {
+template<typename Type, typename Allocator, typename GrowthPolicy>
+List<Type, Allocator, GrowthPolicy> &List<Type, Allocator, GrowthPolicy>::operator=(const List &other) {
     if (this == &other)
         return *this;
 
-    if (capacity < other._size) {
-        Type *new_values = new Type[other.capacity];
-        delete[] values;
+    if constexpr (AllocatorTraits::propagate_on_container_copy_assignment::value) {
+        if (allocator != other.allocator)
+            clear();
+        allocator = other.allocator;
+    }
+
+    if (_capacity < other._size) {
+        Type *new_values = allocate_values(other._capacity);
+        try {
+            detail::uninitialized_copy(other.values, other._size, new_values);
+        } catch (...) {
+            deallocate_values(new_values, other._capacity);
+            throw;
+        }
+
+        detail::destroy(values, _size);
+        deallocate_values(values, _capacity);
         values = new_values;
-        capacity = other.capacity;
+        _capacity = other._capacity;
+    } else {
+        const size_t assigned = _size < other._size ? _size : other._size;
+        detail::copy(other.values, assigned, values);
+
+        if (other._size > _size)
+            detail::uninitialized_copy(other.values + _size, other._size - _size, values + _size);
+        else
+            detail::destroy(values + other._size, _size - other._size);
     }
 
+    record_copies(other._size);
     _size = other._size;
-    for (size_t i = 0; i < _size; ++i)
-        values[i] = other.values[i];
-
     return *this;
 }
 
-template<typename Type>
-List<Type>::List(List &&other) noexcept : values(other.values), capacity(other.capacity), _size(other._size) {
+template<typename Type, typename Allocator, typename GrowthPolicy>
+List<Type, Allocator, GrowthPolicy>::List(List &&other) noexcept :
+    allocator(std::move(other.allocator)), values(other.values), _capacity(other._capacity), _size(other._size) {
+    take_memory(other);
     other.values = nullptr;
-    other.capacity = 0;
+    other._capacity = 0;
     other._size = 0;
 }
 
-template<typename Type>
-List<Type> &List<Type>::operator=(List &&other) noexcept {
+template<typename Type, typename Allocator, typename GrowthPolicy>
+List<Type, Allocator, GrowthPolicy> &List<Type, Allocator, GrowthPolicy>::operator=(List &&other) noexcept(
+    AllocatorTraits::propagate_on_container_move_assignment::value || AllocatorTraits::is_always_equal::value) {
     if (this == &other)
         return *this;
 
-    delete[] values;
+    if constexpr (!AllocatorTraits::propagate_on_container_move_assignment::value &&
+                  !AllocatorTraits::is_always_equal::value) {
+        // other's buffer cannot be released through our allocator, so its elements are moved one by one instead.
+        if (allocator != other.allocator) {
+            Type *new_values = allocate_values(other._size);
+            try {
+                detail::relocate(other.values, other._size, new_values);
+            } catch (...) {
+                deallocate_values(new_values, other._size);
+                throw;
+            }
+            record_relocation<Type>(other._size);
+
+            clear();
+            values = new_values;
+            _capacity = _size = other._size;
+            other._size = 0;
+            other.clear();
+            return *this;
+        }
+    }
 
+    clear();
+    if constexpr (AllocatorTraits::propagate_on_container_move_assignment::value)
+        allocator = std::move(other.allocator);
+
+    take_memory(other);
     values = other.values;
-    capacity = other.capacity;
+    _capacity = other._capacity;
     _size = other._size;
 
     other.values = nullptr;
-    other.capacity = 0;
+    other._capacity = 0;
     other._size = 0;
 
     return *this;
 }
 
-template<typename Type>
-void List<Type>::push_back(const Type &value) {
-    if (_size == capacity)
-        reallocate(capacity * 2);
+template<typename Type, typename Allocator, typename GrowthPolicy>
+void List<Type, Allocator, GrowthPolicy>::push_back(const Type &value) {
+    emplace_back(value);
+    record_copies(1);
+}
+
+template<typename Type, typename Allocator, typename GrowthPolicy>
+void List<Type, Allocator, GrowthPolicy>::push_back(Type &&value) {
+    emplace_back(std::move(value));
+    record_moves(1);
+}
+
+template<typename Type, typename Allocator, typename GrowthPolicy>
+template<typename... Args>
+Type &List<Type, Allocator, GrowthPolicy>::emplace_back(Args &&...args) {
+    if (_size < _capacity) {
+        new (values + _size) Type(std::forward<Args>(args)...);
+        return values[_size++];
+    }
 
-    values[_size++] = value;
+    // The new element is built before the old ones are relocated, as args may refer to one of them.
+    const size_t new_capacity = grown_capacity(_size + 1);
+    Type *new_values = allocate_values(new_capacity);
+    try {
+        new (new_values + _size) Type(std::forward<Args>(args)...);
+    } catch (...) {
+        deallocate_values(new_values, new_capacity);
+        throw;
+    }
+
+    try {
+        detail::relocate(values, _size, new_values);
+    } catch (...) {
+        new_values[_size].~Type();
+        deallocate_values(new_values, new_capacity);
+        throw;
+    }
+    if (values != nullptr)
+        record_reallocation();
+    record_relocation<Type>(_size);
+
+    deallocate_values(values, _capacity);
+    values = new_values;
+    _capacity = new_capacity;
+    return values[_size++];
 }
 
-template<typename Type>
-void List<Type>::pop_back() {
+template<typename Type, typename Allocator, typename GrowthPolicy>
+void List<Type, Allocator, GrowthPolicy>::pop_back() {
     if (_size == 0)
         return;
 
-    --_size;
-    if (_size <= capacity / 4 && capacity > 8)
-        reallocate(capacity / 2);
+    values[--_size].~Type();
+    shrink_if_sparse();
 }
 
-template<typename Type>
-void List<Type>::push_front(const Type &value) {
-    if (_size == capacity)
-        reallocate(capacity * 2);
+template<typename Type, typename Allocator, typename GrowthPolicy>
+void List<Type, Allocator, GrowthPolicy>::push_front(const Type &value) {
+    emplace_front(value);
+    record_copies(1);
+}
+
+template<typename Type, typename Allocator, typename GrowthPolicy>
+void List<Type, Allocator, GrowthPolicy>::push_front(Type &&value) {
+    emplace_front(std::move(value));
+    record_moves(1);
+}
 
-    for (size_t index = _size; index > 0; --index)
-        values[index] = values[index - 1];
+template<typename Type, typename Allocator, typename GrowthPolicy>
+template<typename... Args>
+Type &List<Type, Allocator, GrowthPolicy>::emplace_front(Args &&...args) {
+    Type value(std::forward<Args>(args)...);
+
+    if (_size == _capacity)
+        reallocate(grown_capacity(_size + 1));
+
+    if (_size == 0) {
+        new (values) Type(std::move(value));
+    } else {
+        detail::shift_right(values, _size);
+        values[0] = std::move(value);
+    }
 
-    values[0] = value;
+    record_moves(_size + 1);
     ++_size;
+    return values[0];
 }
 
-template<typename Type>
-void List<Type>::pop_front() {
+template<typename Type, typename Allocator, typename GrowthPolicy>
+void List<Type, Allocator, GrowthPolicy>::pop_front() {
     if (_size == 0)
         return;
 
-    for (size_t index = 0; index < _size - 1; ++index)
-        values[index] = values[index + 1];
+    record_moves(_size - 1);
+    detail::shift_left(values, _size--);
+    shrink_if_sparse();
+}
+
+template<typename Type, typename Allocator, typename GrowthPolicy>
+template<typename InputIterator>
+void List<Type, Allocator, GrowthPolicy>::append(InputIterator first, InputIterator last) {
+    if constexpr (detail::is_forward_iterator_v<InputIterator>)
+        reserve_for(_size + static_cast<size_t>(std::distance(first, last)));
 
-    --_size;
-    if (_size <= capacity / 4 && capacity > 8)
-        reallocate(capacity / 2);
+    for (; first != last; ++first)
+        emplace_back(*first);
 }
 
-template<typename Type>
-Type &List<Type>::front() {
+template<typename Type, typename Allocator, typename GrowthPolicy>
+template<typename Fill>
+void List<Type, Allocator, GrowthPolicy>::append_uninitialized(size_t count, Fill fill) {
+    static_assert(std::is_trivially_copyable_v<Type>, "Only trivially copyable elements can be written as raw bytes");
+    reserve_for(_size + count);
+    fill(values + _size, count);
+    _size += count;
+}
+
+// The range is appended, then rotated into place, which also works for single-pass input iterators.
+template<typename Type, typename Allocator, typename GrowthPolicy>
+template<typename InputIterator>
+void List<Type, Allocator, GrowthPolicy>::insert(size_t index, InputIterator first, InputIterator last) {
+    if (index > _size)
+        throw std::out_of_range("Index out of range");
+
+    const size_t old_size = _size;
+    append(first, last);
+    std::rotate(values + index, values + old_size, values + _size);
+    record_moves(_size - index);
+}
+
+template<typename Type, typename Allocator, typename GrowthPolicy>
+void List<Type, Allocator, GrowthPolicy>::erase(size_t index) {
+    erase(index, index + 1);
+}
+
+template<typename Type, typename Allocator, typename GrowthPolicy>
+void List<Type, Allocator, GrowthPolicy>::erase(size_t first, size_t last) {
+    if (first > last || last > _size)
+        throw std::out_of_range("Index out of range");
+    if (first == last)
+        return;
+
+    const size_t count = last - first;
+    std::move(values + last, values + _size, values + first);
+    record_moves(_size - last);
+    detail::destroy(values + _size - count, count);
+    _size -= count;
+    shrink_if_sparse();
+}
+
+template<typename Type, typename Allocator, typename GrowthPolicy>
+Type &List<Type, Allocator, GrowthPolicy>::front() {
     if (_size == 0)
         throw std::out_of_range("List is empty");
     return values[0];
 }
 
-template<typename Type>
-const Type &List<Type>::front() const {
+template<typename Type, typename Allocator, typename GrowthPolicy>
+const Type &List<Type, Allocator, GrowthPolicy>::front() const {
     if (_size == 0)
         throw std::out_of_range("List is empty");
     return values[0];
 }
 
-template<typename Type>
-Type &List<Type>::back() {
+template<typename Type, typename Allocator, typename GrowthPolicy>
+Type &List<Type, Allocator, GrowthPolicy>::back() {
     if (_size == 0)
         throw std::out_of_range("List is empty");
     return values[_size - 1];
 }
 
-template<typename Type>
-const Type &List<Type>::back() const {
+template<typename Type, typename Allocator, typename GrowthPolicy>
+const Type &List<Type, Allocator, GrowthPolicy>::back() const {
     if (_size == 0)
         throw std::out_of_range("List is empty");
     return values[_size - 1];
 }
 
-template<typename Type>
-Type &List<Type>::at(size_t index) {
+template<typename Type, typename Allocator, typename GrowthPolicy>
+Type &List<Type, Allocator, GrowthPolicy>::at(size_t index) {
     return const_cast<Type &>(static_cast<const List &>(*this).at(index));
 }
 
-template<typename Type>
-const Type &List<Type>::at(size_t index) const {
+template<typename Type, typename Allocator, typename GrowthPolicy>
+const Type &List<Type, Allocator, GrowthPolicy>::at(size_t index) const {
     if (index >= _size)
         throw std::out_of_range("Index out of range");
     return values[index];
 }
 
-template<typename Type>
-void List<Type>::clear() {
-    delete[] values;
-    values = new Type[capacity = 8];
+template<typename Type, typename Allocator, typename GrowthPolicy>
+void List<Type, Allocator, GrowthPolicy>::reserve(size_t new_capacity) {
+    if (new_capacity > _capacity)
+        reallocate(new_capacity);
+}
+
+template<typename Type, typename Allocator, typename GrowthPolicy>
+void List<Type, Allocator, GrowthPolicy>::resize(size_t new_size) {
+    if (new_size <= _size) {
+        detail::destroy(values + new_size, _size - new_size);
+        _size = new_size;
+        return;
+    }
+
+    reserve_for(new_size);
+    for (; _size < new_size; ++_size)
+        new (values + _size) Type();
+}
+
+template<typename Type, typename Allocator, typename GrowthPolicy>
+void List<Type, Allocator, GrowthPolicy>::resize(size_t new_size, const Type &value) {
+    if (new_size <= _size) {
+        detail::destroy(values + new_size, _size - new_size);
+        _size = new_size;
+        return;
+    }
+
+    if (new_size > _capacity) {
+        // value may be one of the elements, which the reallocation is about to move.
+        const Type copy(value);
+        reserve_for(new_size);
+        for (; _size < new_size; ++_size)
+            new (values + _size) Type(copy);
+    } else {
+        for (; _size < new_size; ++_size)
+            new (values + _size) Type(value);
+    }
+}
+
+template<typename Type, typename Allocator, typename GrowthPolicy>
+void List<Type, Allocator, GrowthPolicy>::shrink_to_fit() {
+    if (_capacity > _size)
+        reallocate(_size);
+}
+
+template<typename Type, typename Allocator, typename GrowthPolicy>
+void List<Type, Allocator, GrowthPolicy>::clear() {
+    detail::destroy(values, _size);
+    deallocate_values(values, _capacity);
+    values = nullptr;
+    _capacity = 0;
     _size = 0;
 }
 
-template<typename Type>
-size_t List<Type>::size() const {
+template<typename Type, typename Allocator, typename GrowthPolicy>
+size_t List<Type, Allocator, GrowthPolicy>::size() const {
     return _size;
 }
 
-template<typename Type>
-bool List<Type>::is_empty() const {
+template<typename Type, typename Allocator, typename GrowthPolicy>
+bool List<Type, Allocator, GrowthPolicy>::is_empty() const {
     return _size == 0;
 }
 
-template<typename Type>
-void List<Type>::reallocate(size_t new_capacity) {
-    Type *new_values = new Type[new_capacity];
+template<typename Type, typename Allocator, typename GrowthPolicy>
+void List<Type, Allocator, GrowthPolicy>::reserve_for(size_t required) {
+    if (required > _capacity)
+        reallocate(grown_capacity(required));
+}
+
+template<typename Type, typename Allocator, typename GrowthPolicy>
+void List<Type, Allocator, GrowthPolicy>::shrink_if_sparse() {
+    size_t new_capacity = _capacity, shrunk;
+    while ((shrunk = GrowthPolicy::shrink(new_capacity, _size)) < new_capacity)
+        new_capacity = shrunk;
 
-    for (size_t index = 0; index < _size; ++index)
-        new_values[index] = values[index];
+    if (new_capacity != _capacity)
+        reallocate(new_capacity);
+}
 
-    delete[] values;
+template<typename Type, typename Allocator, typename GrowthPolicy>
+void List<Type, Allocator, GrowthPolicy>::reallocate(size_t new_capacity) {
+    Type *new_values = allocate_values(new_capacity);
+    try {
+        detail::relocate(values, _size, new_values);
+    } catch (...) {
+        deallocate_values(new_values, new_capacity);
+        throw;
+    }
+    if (values != nullptr)
+        record_reallocation();
+    record_relocation<Type>(_size);
+
+    deallocate_values(values, _capacity);
     values = new_values;
-    capacity = new_capacity;
+    _capacity = new_capacity;
+}
+
+template<typename Type, typename Allocator, typename GrowthPolicy>
+Type *List<Type, Allocator, GrowthPolicy>::allocate_values(size_t count) {
+    Type *buffer = detail::allocate(allocator, count);
+    record_allocation(count * sizeof(Type));
+    return buffer;
+}
+
+template<typename Type, typename Allocator, typename GrowthPolicy>
+void List<Type, Allocator, GrowthPolicy>::deallocate_values(Type *buffer, size_t count) noexcept {
+    if (buffer != nullptr)
+        record_deallocation(count * sizeof(Type));
+    detail::deallocate(allocator, buffer, count);
 }
 
 #endif // LIST_H
@@ -0,0 +1,121 @@
+#ifndef LOCK_FREE_STACK_H
+#define LOCK_FREE_STACK_H
+
+#include <atomic>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include "HazardPointers.h"
+
+// A Treiber stack: a LinkedList whose head is swapped with compare-and-swap, so that any number of threads push and
+// pop at once without a lock. A popping thread protects the head with a hazard pointer before reading it, which keeps
+// another thread from freeing the node under it and from pushing it back as a new node at the same address (the ABA
+// problem). Popped nodes are freed later, once no thread can still be reading them.
+// Allocator is called from every thread using the stack, so it must be thread-safe, as std::allocator is.
+template<typename Type, typename Allocator = std::allocator<Type>>
+class LockFreeStack {
+    struct Node {
+        template<typename... Args>
+        explicit Node(Args &&...args) : value(std::forward<Args>(args)...) {}
+
+        Type value;
+        std::atomic<Node *> next{nullptr};
+    };
+
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using NodeAllocatorTraits = std::allocator_traits<NodeAllocator>;
+
+public:
+    LockFreeStack() = default;
+    explicit LockFreeStack(const Allocator &allocator) : allocator(allocator) {}
+    ~LockFreeStack();
+
+    LockFreeStack(const LockFreeStack &other) = delete;
+    LockFreeStack &operator=(const LockFreeStack &other) = delete;
+
+    void push_front(Type value) { emplace_front(std::move(value)); }
+    template<typename... Args>
+    void emplace_front(Args &&...args);
+
+    // Moves the last pushed element into value and returns true, or returns false when the stack was found empty.
+    bool try_pop_front(Type &value);
+
+    // A snapshot, which other threads may have changed by the time it is used.
+    [[nodiscard]] bool is_empty() const { return head.load(std::memory_order_acquire) == nullptr; }
+    [[nodiscard]] Allocator get_allocator() const { return Allocator(allocator); }
+
+private:
+    template<typename... Args>
+    Node *create_node(Args &&...args);
+    void destroy_node(Node *node) noexcept;
+
+    NodeAllocator allocator;
+    std::atomic<Node *> head{nullptr};
+    HazardPointers<Node> hazards;
+};
+
+template<typename Type, typename Allocator>
+LockFreeStack<Type, Allocator>::~LockFreeStack() {
+    Node *node = head.load(std::memory_order_acquire);
+    while (node != nullptr) {
+        Node *next = node->next.load(std::memory_order_relaxed);
+        destroy_node(node);
+        node = next;
+    }
+    hazards.reclaim([this](Node *retired) { destroy_node(retired); });
+}
+
+template<typename Type, typename Allocator>
+template<typename... Args>
+void LockFreeStack<Type, Allocator>::emplace_front(Args &&...args) {
+    Node *node = create_node(std::forward<Args>(args)...);
+    Node *first = head.load(std::memory_order_relaxed);
+    do {
+        node->next.store(first, std::memory_order_relaxed);
+    } while (!head.compare_exchange_weak(first, node, std::memory_order_release, std::memory_order_relaxed));
+}
+
+// The value is moved out after the node was unlinked, once this thread is the only one that may read it: others can
+// only load its next pointer, whose compare-and-swap then fails.
+template<typename Type, typename Allocator>
+bool LockFreeStack<Type, Allocator>::try_pop_front(Type &value) {
+    Node *node = nullptr;
+    {
+        typename HazardPointers<Node>::Guard guard(hazards);
+        for (;;) {
+            node = guard.protect(head);
+            if (node == nullptr)
+                return false;
+
+            Node *next = node->next.load(std::memory_order_relaxed);
+            if (head.compare_exchange_strong(node, next))
+                break;
+        }
+    }
+
+    value = std::move(node->value);
+    hazards.retire(node, [this](Node *retired) { destroy_node(retired); });
+    return true;
+}
+
+template<typename Type, typename Allocator>
+template<typename... Args>
+typename LockFreeStack<Type, Allocator>::Node *LockFreeStack<Type, Allocator>::create_node(Args &&...args) {
+    Node *node = NodeAllocatorTraits::allocate(allocator, 1);
+    try {
+        new (node) Node(std::forward<Args>(args)...);
+    } catch (...) {
+        NodeAllocatorTraits::deallocate(allocator, node, 1);
+        throw;
+    }
+    return node;
+}
+
+template<typename Type, typename Allocator>
+void LockFreeStack<Type, Allocator>::destroy_node(Node *node) noexcept {
+    node->~Node();
+    NodeAllocatorTraits::deallocate(allocator, node, 1);
+}
+
+#endif // LOCK_FREE_STACK_H
@@ -0,0 +1,162 @@
+#ifndef MAPPED_LIST_H
+#define MAPPED_LIST_H
+
+#include <cerrno>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ContiguousIterator.h"
+#include "Snapshot.h"
+
+// A read-only List over a snapshot file, see Snapshot.h, mapped into memory instead of read: opening it costs the
+// same whatever its size, and the elements are only paged in from the file, or from the page cache if it was read
+// recently, once they are touched. Processes mapping the same file share its pages.
+// Any snapshot of List, Array or Heap maps, a Heap's elements appearing in heap order. The file must not be modified
+// while mapped. POSIX only.
+template<typename Type>
+class MappedList {
+public:
+    MappedList() = default;
+    // Throws system_error when the file cannot be mapped, and runtime_error when it does not hold a snapshot of Type.
+    explicit MappedList(const std::string &path);
+    ~MappedList() { unmap(); }
+
+    MappedList(const MappedList &other) = delete;
+    MappedList &operator=(const MappedList &other) = delete;
+    MappedList(MappedList &&other) noexcept;
+    MappedList &operator=(MappedList &&other) noexcept;
+
+    // Both throw out_of_range on an empty list, as List does.
+    const Type &front() const;
+    const Type &back() const;
+
+    const Type &at(size_t index) const;
+    const Type &operator[](size_t index) const { return values[index]; }
+    const Type *data() const { return values; }
+
+    [[nodiscard]] size_t size() const { return _size; }
+    [[nodiscard]] bool is_empty() const { return _size == 0; }
+
+    using Iterator = ContiguousIterator<const Type>;
+    using ConstIterator = ContiguousIterator<const Type>;
+
+    ConstIterator begin() const { return ConstIterator(values, 0); }
+    ConstIterator end() const { return ConstIterator(values, _size); }
+    ConstIterator cbegin() const { return ConstIterator(values, 0); }
+    ConstIterator cend() const { return ConstIterator(values, _size); }
+
+private:
+    void unmap() noexcept;
+
+    void *mapping = nullptr;
+    size_t mapping_size = 0;
+    const Type *values = nullptr;
+    size_t _size = 0;
+};
+
+// The file descriptor is closed right away: the mapping keeps the file alive on its own.
+template<typename Type>
+MappedList<Type>::MappedList(const std::string &path) {
+    const int file = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (file < 0)
+        throw std::system_error(errno, std::generic_category(), "Cannot open snapshot " + path);
+
+    struct stat status{};
+    if (::fstat(file, &status) != 0) {
+        const int error = errno;
+        ::close(file);
+        throw std::system_error(error, std::generic_category(), "Cannot open snapshot " + path);
+    }
+
+    const auto file_size = static_cast<size_t>(status.st_size);
+    if (file_size < sizeof(SnapshotHeader)) {
+        ::close(file);
+        throw std::runtime_error("Snapshot is truncated");
+    }
+
+    void *address = ::mmap(nullptr, file_size, PROT_READ, MAP_SHARED, file, 0);
+    const int error = errno;
+    ::close(file);
+    if (address == MAP_FAILED)
+        throw std::system_error(error, std::generic_category(), "Cannot map snapshot " + path);
+
+    mapping = address;
+    mapping_size = file_size;
+    const auto *header = static_cast<const SnapshotHeader *>(address);
+    try {
+        detail::check_snapshot_header<Type>(*header, nullptr, file_size);
+    } catch (...) {
+        unmap();
+        throw;
+    }
+
+    values = reinterpret_cast<const Type *>(static_cast<const char *>(address) + header->data_offset);
+    _size = static_cast<size_t>(header->count);
+}
+
+template<typename Type>
+MappedList<Type>::MappedList(MappedList &&other) noexcept :
+    mapping(other.mapping), mapping_size(other.mapping_size), values(other.values), _size(other._size) {
+    other.mapping = nullptr;
+    other.mapping_size = 0;
+    other.values = nullptr;
+    other._size = 0;
+}
+
+template<typename Type>
+MappedList<Type> &MappedList<Type>::operator=(MappedList &&other) noexcept {
+    if (this == &other)
+        return *this;
+
+    unmap();
+    mapping = other.mapping;
+    mapping_size = other.mapping_size;
+    values = other.values;
+    _size = other._size;
+
+    other.mapping = nullptr;
+    other.mapping_size = 0;
+    other.values = nullptr;
+    other._size = 0;
+    return *this;
+}
+
+template<typename Type>
+const Type &MappedList<Type>::front() const {
+    if (_size == 0)
+        throw std::out_of_range("MappedList is empty");
+    return values[0];
+}
+
+template<typename Type>
+const Type &MappedList<Type>::back() const {
+    if (_size == 0)
+        throw std::out_of_range("MappedList is empty");
+    return values[_size - 1];
+}
+
+template<typename Type>
+const Type &MappedList<Type>::at(size_t index) const {
+    if (index >= _size)
+        throw std::out_of_range("MappedList index out of range");
+    return values[index];
+}
+
+template<typename Type>
+void MappedList<Type>::unmap() noexcept {
+    if (mapping != nullptr)
+        ::munmap(mapping, mapping_size);
+    mapping = nullptr;
+    mapping_size = 0;
+    values = nullptr;
+    _size = 0;
+}
+
+#endif // MAPPED_LIST_H
@@ -0,0 +1,140 @@
+#ifndef MEMORY_H
+#define MEMORY_H
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// Helpers shared by the containers that manage raw, uninitialized storage themselves.
+namespace detail {
+
+    template<typename Type>
+    Type *allocate(size_t count) {
+        if (count == 0)
+            return nullptr;
+        return static_cast<Type *>(::operator new(count * sizeof(Type)));
+    }
+
+    template<typename Type>
+    void deallocate(Type *values) noexcept {
+        ::operator delete(values);
+    }
+
+    // Allocator-aware counterparts of the two helpers above, going through std::allocator_traits.
+    template<typename Allocator>
+    typename std::allocator_traits<Allocator>::value_type *allocate(Allocator &allocator, size_t count) {
+        if (count == 0)
+            return nullptr;
+        return std::allocator_traits<Allocator>::allocate(allocator, count);
+    }
+
+    template<typename Allocator>
+    void deallocate(Allocator &allocator, typename std::allocator_traits<Allocator>::value_type *values,
+                    size_t count) noexcept {
+        if (values != nullptr)
+            std::allocator_traits<Allocator>::deallocate(allocator, values, count);
+    }
+
+    template<typename Type>
+    void destroy(Type *first, size_t count) noexcept {
+        if constexpr (!std::is_trivially_destructible_v<Type>) {
+            for (size_t index = 0; index < count; ++index)
+                first[index].~Type();
+        }
+    }
+
+    // Copy-constructs count elements into uninitialized storage, undoing the partial work if one throws.
+    template<typename Type>
+    void uninitialized_copy(const Type *source, size_t count, Type *destination) {
+        if constexpr (std::is_trivially_copyable_v<Type>) {
+            if (count != 0)
+                std::memcpy(static_cast<void *>(destination), static_cast<const void *>(source), count * sizeof(Type));
+        } else {
+            size_t index = 0;
+            try {
+                for (; index < count; ++index)
+                    new (destination + index) Type(source[index]);
+            } catch (...) {
+                destroy(destination, index);
+                throw;
+            }
+        }
+    }
+
+    // Copy-assigns count elements over already constructed ones.
+    template<typename Type>
+    void copy(const Type *source, size_t count, Type *destination) {
+        if constexpr (std::is_trivially_copyable_v<Type>) {
+            if (count != 0)
+                std::memmove(static_cast<void *>(destination), static_cast<const void *>(source), count * sizeof(Type));
+        } else {
+            for (size_t index = 0; index < count; ++index)
+                destination[index] = source[index];
+        }
+    }
+
+    // Moves the count elements starting at first one slot to the right, the last one into uninitialized storage.
+    // first[0] is left in a moved-from state, ready to be assigned to.
+    template<typename Type>
+    void shift_right(Type *first, size_t count) {
+        if (count == 0)
+            return;
+
+        if constexpr (std::is_trivially_copyable_v<Type>) {
+            std::memmove(static_cast<void *>(first + 1), static_cast<const void *>(first), count * sizeof(Type));
+        } else {
+            new (first + count) Type(std::move(first[count - 1]));
+            for (size_t index = count - 1; index > 0; --index)
+                first[index] = std::move(first[index - 1]);
+        }
+    }
+
+    // Moves the count - 1 elements after first one slot to the left, over first[0], and destroys the last slot.
+    template<typename Type>
+    void shift_left(Type *first, size_t count) {
+        if (count == 0)
+            return;
+
+        if constexpr (std::is_trivially_copyable_v<Type>) {
+            std::memmove(static_cast<void *>(first), static_cast<const void *>(first + 1), (count - 1) * sizeof(Type));
+        } else {
+            for (size_t index = 0; index < count - 1; ++index)
+                first[index] = std::move(first[index + 1]);
+            first[count - 1].~Type();
+        }
+    }
+
+    // Moves count elements into uninitialized storage, leaving the originals to be destroyed by the caller.
+    // Trivially copyable types are moved with a single memcpy, other types are moved when that cannot throw
+    // (or when they cannot be copied at all) and copied otherwise, so a throwing copy leaves the source intact.
+    template<typename Type>
+    void uninitialized_move_if_noexcept(Type *source, size_t count, Type *destination) {
+        if constexpr (std::is_trivially_copyable_v<Type>) {
+            if (count != 0)
+                std::memcpy(static_cast<void *>(destination), static_cast<const void *>(source), count * sizeof(Type));
+        } else {
+            size_t index = 0;
+            try {
+                for (; index < count; ++index)
+                    new (destination + index) Type(std::move_if_noexcept(source[index]));
+            } catch (...) {
+                destroy(destination, index);
+                throw;
+            }
+        }
+    }
+
+    // Moves count elements into uninitialized storage and destroys the originals, see uninitialized_move_if_noexcept.
+    template<typename Type>
+    void relocate(Type *source, size_t count, Type *destination) {
+        uninitialized_move_if_noexcept(source, count, destination);
+        if constexpr (!std::is_trivially_copyable_v<Type>)
+            destroy(source, count);
+    }
+
+} // namespace detail
+
+#endif // MEMORY_H
@@ -0,0 +1,185 @@
+#ifndef MEMORY_RESOURCE_H
+#define MEMORY_RESOURCE_H
+
+#include <cstddef>
+#include <memory_resource>
+
+// Memory resources to plug into the containers through std::pmr::polymorphic_allocator, e.g.
+//     MonotonicArena arena;
+//     List<int, std::pmr::polymorphic_allocator<int>> list(&arena);
+// The resources must outlive every container allocating from them.
+
+// Hands out memory by bumping a pointer through large blocks and never reuses it: deallocation is a no-op and
+// everything is given back at once by release() or by the destructor. Suited to request-scoped containers.
+class MonotonicArena : public std::pmr::memory_resource {
+public:
+    explicit MonotonicArena(size_t initial_block_size = 1024,
+                            std::pmr::memory_resource *upstream = std::pmr::new_delete_resource());
+    ~MonotonicArena() override { release(); }
+
+    MonotonicArena(const MonotonicArena &other) = delete;
+    MonotonicArena &operator=(const MonotonicArena &other) = delete;
+
+    void release() noexcept;
+    [[nodiscard]] size_t allocated() const { return _allocated; }
+
+private:
+    struct Block {
+        Block *previous;
+        size_t size;
+    };
+
+    void *do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void *, size_t, size_t) override {}
+    bool do_is_equal(const memory_resource &other) const noexcept override { return this == &other; }
+
+    std::pmr::memory_resource *upstream;
+    Block *blocks = nullptr;
+    unsigned char *current = nullptr;
+    size_t remaining = 0;
+    size_t next_block_size;
+    size_t _allocated = 0;
+};
+
+inline MonotonicArena::MonotonicArena(size_t initial_block_size, std::pmr::memory_resource *upstream) :
+    upstream(upstream), next_block_size(initial_block_size < sizeof(Block) ? sizeof(Block) : initial_block_size) {}
+
+inline void MonotonicArena::release() noexcept {
+    while (blocks != nullptr) {
+        Block *previous = blocks->previous;
+        upstream->deallocate(blocks, blocks->size, alignof(std::max_align_t));
+        blocks = previous;
+    }
+
+    current = nullptr;
+    remaining = 0;
+    _allocated = 0;
+}
+
+inline void *MonotonicArena::do_allocate(size_t bytes, size_t alignment) {
+    size_t padding = (alignment - reinterpret_cast<size_t>(current) % alignment) % alignment;
+    if (current == nullptr || padding + bytes > remaining) {
+        // Blocks grow geometrically so a long-lived arena needs few upstream calls, and always fit the request.
+        size_t block_size = next_block_size;
+        while (block_size < sizeof(Block) + bytes + alignment)
+            block_size *= 2;
+        next_block_size = block_size * 2;
+
+        auto *block = static_cast<Block *>(upstream->allocate(block_size, alignof(std::max_align_t)));
+        block->previous = blocks;
+        block->size = block_size;
+        blocks = block;
+
+        current = reinterpret_cast<unsigned char *>(block) + sizeof(Block);
+        remaining = block_size - sizeof(Block);
+        padding = (alignment - reinterpret_cast<size_t>(current) % alignment) % alignment;
+    }
+
+    void *result = current + padding;
+    current += padding + bytes;
+    remaining -= padding + bytes;
+    _allocated += bytes;
+    return result;
+}
+
+// Serves allocations of up to block_size bytes from fixed-size blocks carved out of larger chunks, recycling the freed
+// blocks through an intrusive free list. Larger or over-aligned requests go straight to the upstream resource.
+// Suited to node-based containers such as LinkedList, whose allocations all have the same size.
+class PoolResource : public std::pmr::memory_resource {
+public:
+    explicit PoolResource(size_t block_size, size_t blocks_per_chunk = 64,
+                          std::pmr::memory_resource *upstream = std::pmr::new_delete_resource());
+    ~PoolResource() override { release(); }
+
+    PoolResource(const PoolResource &other) = delete;
+    PoolResource &operator=(const PoolResource &other) = delete;
+
+    void release() noexcept;
+    [[nodiscard]] size_t block_size() const { return _block_size; }
+
+private:
+    struct FreeBlock {
+        FreeBlock *next;
+    };
+
+    struct Chunk {
+        Chunk *previous;
+    };
+
+    [[nodiscard]] bool fits(size_t bytes, size_t alignment) const {
+        return bytes <= _block_size && alignment <= alignof(std::max_align_t);
+    }
+
+    void *do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void *pointer, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const memory_resource &other) const noexcept override { return this == &other; }
+
+    void add_chunk();
+
+    std::pmr::memory_resource *upstream;
+    Chunk *chunks = nullptr;
+    FreeBlock *free_blocks = nullptr;
+    size_t _block_size;
+    size_t blocks_per_chunk;
+};
+
+inline PoolResource::PoolResource(size_t block_size, size_t blocks_per_chunk, std::pmr::memory_resource *upstream) :
+    upstream(upstream), blocks_per_chunk(blocks_per_chunk == 0 ? 1 : blocks_per_chunk) {
+    // Every block must be able to hold a free list link and stay aligned for any type.
+    constexpr size_t alignment = alignof(std::max_align_t);
+    if (block_size < sizeof(FreeBlock))
+        block_size = sizeof(FreeBlock);
+    _block_size = (block_size + alignment - 1) / alignment * alignment;
+}
+
+inline void PoolResource::release() noexcept {
+    while (chunks != nullptr) {
+        Chunk *previous = chunks->previous;
+        upstream->deallocate(chunks, alignof(std::max_align_t) + _block_size * blocks_per_chunk,
+                             alignof(std::max_align_t));
+        chunks = previous;
+    }
+
+    free_blocks = nullptr;
+}
+
+inline void *PoolResource::do_allocate(size_t bytes, size_t alignment) {
+    if (!fits(bytes, alignment))
+        return upstream->allocate(bytes, alignment);
+
+    if (free_blocks == nullptr)
+        add_chunk();
+
+    FreeBlock *block = free_blocks;
+    free_blocks = block->next;
+    return block;
+}
+
+inline void PoolResource::do_deallocate(void *pointer, size_t bytes, size_t alignment) {
+    if (!fits(bytes, alignment)) {
+        upstream->deallocate(pointer, bytes, alignment);
+        return;
+    }
+
+    auto *block = static_cast<FreeBlock *>(pointer);
+    block->next = free_blocks;
+    free_blocks = block;
+}
+
+// A chunk starts with its header, padded to keep the blocks aligned, followed by blocks_per_chunk blocks.
+inline void PoolResource::add_chunk() {
+    constexpr size_t header_size = alignof(std::max_align_t);
+    auto *chunk = static_cast<Chunk *>(
+        upstream->allocate(header_size + _block_size * blocks_per_chunk, alignof(std::max_align_t)));
+    chunk->previous = chunks;
+    chunks = chunk;
+
+    unsigned char *first = reinterpret_cast<unsigned char *>(chunk) + header_size;
+    for (size_t index = blocks_per_chunk; index > 0; --index) {
+        auto *block = reinterpret_cast<FreeBlock *>(first + (index - 1) * _block_size);
+        block->next = free_blocks;
+        free_blocks = block;
+    }
+}
+
+#endif // MEMORY_RESOURCE_H
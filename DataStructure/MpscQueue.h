@@ -0,0 +1,122 @@
+#ifndef MPSC_QUEUE_H
+#define MPSC_QUEUE_H
+
+#include <atomic>
+#include <memory>
+#include <new>
+#include <utility>
+
+// A multi-producer single-consumer queue: a LinkedList whose tail any number of threads push_back to at once without a
+// lock, and whose head a single thread pops from. A producer swaps its node in as the new tail, then links it behind
+// the previous one; the consumer never follows a link that is not set yet, so a node it frees can no longer be
+// reached by a producer, and no deferred reclamation is needed.
+// The head is a node whose value was already popped, so that head and tail never meet and producers and the consumer
+// never write to the same node. For a moment after a producer swapped the tail, the consumer cannot see its element,
+// nor those pushed after it, and may find the queue empty.
+// Allocator is called from every producer and from the consumer, so it must be thread-safe, as std::allocator is.
+template<typename Type, typename Allocator = std::allocator<Type>>
+class MpscQueue {
+    struct Node {
+        Node() {}
+        ~Node() {}
+
+        std::atomic<Node *> next{nullptr};
+        // Only constructed between the push and the pop of the element.
+        union {
+            Type value;
+        };
+    };
+
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using NodeAllocatorTraits = std::allocator_traits<NodeAllocator>;
+
+public:
+    MpscQueue() : MpscQueue(Allocator()) {}
+    explicit MpscQueue(const Allocator &allocator);
+    ~MpscQueue();
+
+    MpscQueue(const MpscQueue &other) = delete;
+    MpscQueue &operator=(const MpscQueue &other) = delete;
+
+    // Safe from any number of threads at once.
+    void push_back(Type value) { emplace_back(std::move(value)); }
+    template<typename... Args>
+    void emplace_back(Args &&...args);
+
+    // Consumer only. Moves the first element into value and returns true, or returns false when none is visible yet.
+    bool try_pop_front(Type &value);
+    // Consumer only.
+    [[nodiscard]] bool is_empty() const { return head->next.load(std::memory_order_acquire) == nullptr; }
+
+    [[nodiscard]] Allocator get_allocator() const { return Allocator(allocator); }
+
+private:
+    Node *allocate_node();
+    void deallocate_node(Node *node) noexcept;
+
+    NodeAllocator allocator;
+    // Producers hammer the tail while the consumer walks the head: each gets its own cache line.
+    alignas(64) std::atomic<Node *> tail;
+    alignas(64) Node *head;
+};
+
+template<typename Type, typename Allocator>
+MpscQueue<Type, Allocator>::MpscQueue(const Allocator &allocator) : allocator(allocator) {
+    head = allocate_node();
+    tail.store(head, std::memory_order_relaxed);
+}
+
+template<typename Type, typename Allocator>
+MpscQueue<Type, Allocator>::~MpscQueue() {
+    Node *next = head->next.load(std::memory_order_acquire);
+    deallocate_node(head);
+    while (next != nullptr) {
+        Node *node = next;
+        next = node->next.load(std::memory_order_acquire);
+        node->value.~Type();
+        deallocate_node(node);
+    }
+}
+
+template<typename Type, typename Allocator>
+template<typename... Args>
+void MpscQueue<Type, Allocator>::emplace_back(Args &&...args) {
+    Node *node = allocate_node();
+    try {
+        new (&node->value) Type(std::forward<Args>(args)...);
+    } catch (...) {
+        deallocate_node(node);
+        throw;
+    }
+
+    Node *previous = tail.exchange(node, std::memory_order_acq_rel);
+    previous->next.store(node, std::memory_order_release);
+}
+
+// The first element lives in the node after the head, which becomes the new head once its value is moved out.
+template<typename Type, typename Allocator>
+bool MpscQueue<Type, Allocator>::try_pop_front(Type &value) {
+    Node *next = head->next.load(std::memory_order_acquire);
+    if (next == nullptr)
+        return false;
+
+    value = std::move(next->value);
+    next->value.~Type();
+    deallocate_node(head);
+    head = next;
+    return true;
+}
+
+template<typename Type, typename Allocator>
+typename MpscQueue<Type, Allocator>::Node *MpscQueue<Type, Allocator>::allocate_node() {
+    Node *node = NodeAllocatorTraits::allocate(allocator, 1);
+    return new (node) Node();
+}
+
+template<typename Type, typename Allocator>
+void MpscQueue<Type, Allocator>::deallocate_node(Node *node) noexcept {
+    node->~Node();
+    NodeAllocatorTraits::deallocate(allocator, node, 1);
+}
+
+#endif // MPSC_QUEUE_H
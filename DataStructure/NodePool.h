@@ -0,0 +1,184 @@
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include "ContainerStats.h"
+
+// Storage for the nodes of a node-based container, carved out of chunks obtained from Allocator and recycled through
+// an intrusive free list: a node costs a pointer swap instead of a call into the allocator, and nodes allocated
+// together sit next to each other. Chunks double in size up to max_chunk_size nodes and are only given back by
+// release() or by the destructor, once the container destroyed every node.
+// allocate() returns raw storage, which the container constructs its node into and destroys it before deallocate().
+template<typename Node, typename Allocator = std::allocator<Node>>
+class NodePool : private detail::StatsRecorder<> {
+    using AllocatorTraits = std::allocator_traits<Allocator>;
+
+public:
+    static constexpr size_t min_chunk_size = 16;
+    static constexpr size_t max_chunk_size = 1024;
+
+    NodePool() = default;
+    explicit NodePool(const Allocator &allocator) : allocator(allocator) {}
+    ~NodePool() { release(); }
+
+    NodePool(const NodePool &other) = delete;
+    NodePool &operator=(const NodePool &other) = delete;
+
+    NodePool(NodePool &&other) noexcept;
+    // Takes other's allocator along with its chunks, so only for allocators propagating on move assignment.
+    NodePool &operator=(NodePool &&other) noexcept;
+
+    Node *allocate();
+    void deallocate(Node *node) noexcept;
+
+    // Takes over the chunks and free nodes of other in O(1), leaving it empty. Nodes allocated from other may then be
+    // deallocated to this pool. The allocators must compare equal.
+    void splice(NodePool &other) noexcept;
+
+    // Gives every chunk back to the allocator. Every node must have been destroyed.
+    void release() noexcept;
+
+    [[nodiscard]] Allocator get_allocator() const { return allocator; }
+    // The chunks obtained from the allocator, which recycled nodes do not show in.
+    using detail::StatsRecorder<>::stats;
+
+private:
+    struct FreeNode {
+        FreeNode *next;
+    };
+
+    // The header takes the first slot of its chunk.
+    struct Chunk {
+        Chunk *next;
+        size_t size;
+    };
+
+    static_assert(sizeof(Node) >= sizeof(Chunk) && sizeof(Node) >= sizeof(FreeNode),
+                  "NodePool slots must fit the pool's own bookkeeping");
+
+    void add_chunk();
+    void steal(NodePool &other) noexcept;
+
+    Allocator allocator;
+    Chunk *chunks = nullptr;
+    Chunk *last_chunk = nullptr;
+    FreeNode *free_nodes = nullptr;
+    FreeNode *last_free_node = nullptr;
+    size_t next_chunk_size = min_chunk_size;
+};
+
+template<typename Node, typename Allocator>
+NodePool<Node, Allocator>::NodePool(NodePool &&other) noexcept : allocator(std::move(other.allocator)) {
+    steal(other);
+}
+
+template<typename Node, typename Allocator>
+NodePool<Node, Allocator> &NodePool<Node, Allocator>::operator=(NodePool &&other) noexcept {
+    if (this == &other)
+        return *this;
+
+    release();
+    allocator = std::move(other.allocator);
+    steal(other);
+    return *this;
+}
+
+template<typename Node, typename Allocator>
+Node *NodePool<Node, Allocator>::allocate() {
+    if (free_nodes == nullptr)
+        add_chunk();
+
+    FreeNode *node = free_nodes;
+    free_nodes = node->next;
+    if (free_nodes == nullptr)
+        last_free_node = nullptr;
+    return reinterpret_cast<Node *>(node);
+}
+
+template<typename Node, typename Allocator>
+void NodePool<Node, Allocator>::deallocate(Node *node) noexcept {
+    auto *free_node = new (static_cast<void *>(node)) FreeNode{free_nodes};
+    if (free_nodes == nullptr)
+        last_free_node = free_node;
+    free_nodes = free_node;
+}
+
+template<typename Node, typename Allocator>
+void NodePool<Node, Allocator>::splice(NodePool &other) noexcept {
+    if (this == &other)
+        return;
+
+    take_memory(other);
+    if (other.chunks != nullptr) {
+        other.last_chunk->next = chunks;
+        if (chunks == nullptr)
+            last_chunk = other.last_chunk;
+        chunks = other.chunks;
+    }
+
+    if (other.free_nodes != nullptr) {
+        other.last_free_node->next = free_nodes;
+        if (free_nodes == nullptr)
+            last_free_node = other.last_free_node;
+        free_nodes = other.free_nodes;
+    }
+
+    if (other.next_chunk_size > next_chunk_size)
+        next_chunk_size = other.next_chunk_size;
+
+    other.chunks = other.last_chunk = nullptr;
+    other.free_nodes = other.last_free_node = nullptr;
+    other.next_chunk_size = min_chunk_size;
+}
+
+template<typename Node, typename Allocator>
+void NodePool<Node, Allocator>::release() noexcept {
+    while (chunks != nullptr) {
+        Chunk *next = chunks->next;
+        record_deallocation((chunks->size + 1) * sizeof(Node));
+        AllocatorTraits::deallocate(allocator, reinterpret_cast<Node *>(chunks), chunks->size + 1);
+        chunks = next;
+    }
+
+    last_chunk = nullptr;
+    free_nodes = last_free_node = nullptr;
+    next_chunk_size = min_chunk_size;
+}
+
+// The slots are pushed from the last one, so that consecutive allocations come out in address order.
+template<typename Node, typename Allocator>
+void NodePool<Node, Allocator>::add_chunk() {
+    const size_t size = next_chunk_size;
+    Node *slots = AllocatorTraits::allocate(allocator, size + 1);
+    record_allocation((size + 1) * sizeof(Node));
+    auto *chunk = new (static_cast<void *>(slots)) Chunk{chunks, size};
+    if (chunks == nullptr)
+        last_chunk = chunk;
+    chunks = chunk;
+
+    for (size_t index = size; index > 0; --index)
+        deallocate(slots + index);
+
+    if (next_chunk_size < max_chunk_size)
+        next_chunk_size *= 2;
+}
+
+template<typename Node, typename Allocator>
+void NodePool<Node, Allocator>::steal(NodePool &other) noexcept {
+    take_memory(other);
+    chunks = other.chunks;
+    last_chunk = other.last_chunk;
+    free_nodes = other.free_nodes;
+    last_free_node = other.last_free_node;
+    next_chunk_size = other.next_chunk_size;
+
+    other.chunks = other.last_chunk = nullptr;
+    other.free_nodes = other.last_free_node = nullptr;
+    other.next_chunk_size = min_chunk_size;
+}
+
+#endif // NODE_POOL_H
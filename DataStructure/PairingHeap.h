@@ -0,0 +1,335 @@
+#ifndef PAIRING_HEAP_H
+#define PAIRING_HEAP_H
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "ContainerStats.h"
+#include "List.h"
+#include "NodePool.h"
+
+// A meldable heap with Heap's interface: inserts and merges are O(1), and pops O(log n) amortized. The root is the top
+// and every other node hangs from its parent's list of children, through a child and a sibling pointer.
+// merge(other) links the two roots, where an array-based Heap has to drain one into the other. Nodes come from a
+// NodePool, whose chunks follow the nodes when two heaps merge.
+template<typename Type, typename Comparator = std::less<Type>, typename Allocator = std::allocator<Type>>
+class PairingHeap : private detail::StatsRecorder<> {
+    struct Node {
+        template<typename... Args>
+        explicit Node(Args &&...args) : value(std::forward<Args>(args)...) {}
+
+        Type value;
+        Node *child = nullptr;
+        Node *sibling = nullptr;
+    };
+
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using AllocatorTraits = std::allocator_traits<NodeAllocator>;
+
+public:
+    explicit PairingHeap(Comparator comparator = Comparator(), const Allocator &allocator = Allocator()) :
+        pool(NodeAllocator(allocator)), comparator(comparator) {}
+    template<typename InputIterator, typename = std::enable_if_t<!std::is_integral_v<InputIterator>>>
+    PairingHeap(InputIterator first, InputIterator last, Comparator comparator = Comparator(),
+                const Allocator &allocator = Allocator());
+    ~PairingHeap() { destroy_nodes(); }
+
+    PairingHeap(const PairingHeap &other);
+    PairingHeap &operator=(const PairingHeap &other);
+
+    PairingHeap(PairingHeap &&other) noexcept;
+    PairingHeap &operator=(PairingHeap &&other) noexcept(
+        AllocatorTraits::propagate_on_container_move_assignment::value || AllocatorTraits::is_always_equal::value);
+
+    void insert(const Type &value) { push(value); }
+    void push(const Type &value);
+    void push(Type &&value);
+    template<typename... Args>
+    void emplace(Args &&...args);
+
+    // Moves every element of other into this heap and leaves other empty. O(1) when both allocators compare equal,
+    // otherwise the elements of other are moved one by one.
+    void merge(PairingHeap &other);
+
+    const Type &peek() const;
+    Type pop();
+
+    [[nodiscard]] bool isEmpty() const { return _size == 0; }
+    [[nodiscard]] size_t size() const { return _size; }
+    [[nodiscard]] Allocator get_allocator() const { return Allocator(pool.get_allocator()); }
+    // The pool's chunks along with the elements copied and moved in and out of nodes.
+    [[nodiscard]] ContainerStats stats() const;
+
+private:
+    template<typename... Args>
+    Node *create_node(Args &&...args);
+    Node *link(Node *first, Node *second);
+    Node *link_pairs(Node *first);
+    void destroy_node(Node *node) noexcept;
+    void destroy_nodes() noexcept;
+    void move_elements_from(PairingHeap &other);
+
+    NodePool<Node, NodeAllocator> pool;
+    Node *root = nullptr;
+    size_t _size = 0;
+    Comparator comparator;
+};
+
+template<typename Type, typename Comparator, typename Allocator>
+template<typename InputIterator, typename>
+PairingHeap<Type, Comparator, Allocator>::PairingHeap(InputIterator first, InputIterator last, Comparator comparator,
+                                                      const Allocator &allocator) :
+    PairingHeap(comparator, allocator) {
+    for (; first != last; ++first)
+        emplace(*first);
+    record_copies(_size);
+}
+
+// The copy keeps the shape of other's tree, walking it with an explicit stack: the tree can be as deep as the heap is
+// large.
+template<typename Type, typename Comparator, typename Allocator>
+PairingHeap<Type, Comparator, Allocator>::PairingHeap(const PairingHeap &other) :
+    pool(AllocatorTraits::select_on_container_copy_construction(other.pool.get_allocator())),
+    comparator(other.comparator) {
+    if (other.root == nullptr)
+        return;
+
+    try {
+        List<std::pair<const Node *, Node *>> pending;
+        root = create_node(other.root->value);
+        pending.push_back({other.root, root});
+        while (!pending.is_empty()) {
+            auto [source, copy] = pending.back();
+            pending.pop_back();
+
+            Node **next = &copy->child;
+            for (const Node *child = source->child; child != nullptr; child = child->sibling) {
+                *next = create_node(child->value);
+                pending.push_back({child, *next});
+                next = &(*next)->sibling;
+            }
+        }
+    } catch (...) {
+        destroy_nodes();
+        throw;
+    }
+    _size = other._size;
+    record_copies(_size);
+}
+
+template<typename Type, typename Comparator, typename Allocator>
+PairingHeap<Type, Comparator, Allocator> &
+PairingHeap<Type, Comparator, Allocator>::operator=(const PairingHeap &other) {
+    if (this == &other)
+        return *this;
+
+    PairingHeap copy(other);
+    *this = std::move(copy);
+    take_stats(copy);
+    return *this;
+}
+
+template<typename Type, typename Comparator, typename Allocator>
+PairingHeap<Type, Comparator, Allocator>::PairingHeap(PairingHeap &&other) noexcept :
+    pool(std::move(other.pool)), root(other.root), _size(other._size), comparator(std::move(other.comparator)) {
+    other.root = nullptr;
+    other._size = 0;
+}
+
+template<typename Type, typename Comparator, typename Allocator>
+PairingHeap<Type, Comparator, Allocator> &PairingHeap<Type, Comparator, Allocator>::operator=(
+    PairingHeap &&other) noexcept(AllocatorTraits::propagate_on_container_move_assignment::value ||
+                                  AllocatorTraits::is_always_equal::value) {
+    if (this == &other)
+        return *this;
+
+    destroy_nodes();
+    pool.release();
+    comparator = std::move(other.comparator);
+
+    if constexpr (AllocatorTraits::propagate_on_container_move_assignment::value) {
+        pool = std::move(other.pool);
+    } else {
+        if constexpr (!AllocatorTraits::is_always_equal::value) {
+            // other's nodes cannot be released through our allocator, so its elements are moved one by one instead.
+            if (pool.get_allocator() != other.pool.get_allocator()) {
+                move_elements_from(other);
+                return *this;
+            }
+        }
+        pool.splice(other.pool);
+    }
+
+    root = other.root;
+    _size = other._size;
+    other.root = nullptr;
+    other._size = 0;
+    return *this;
+}
+
+template<typename Type, typename Comparator, typename Allocator>
+void PairingHeap<Type, Comparator, Allocator>::push(const Type &value) {
+    emplace(value);
+    record_copies(1);
+}
+
+template<typename Type, typename Comparator, typename Allocator>
+void PairingHeap<Type, Comparator, Allocator>::push(Type &&value) {
+    emplace(std::move(value));
+    record_moves(1);
+}
+
+template<typename Type, typename Comparator, typename Allocator>
+template<typename... Args>
+void PairingHeap<Type, Comparator, Allocator>::emplace(Args &&...args) {
+    root = link(root, create_node(std::forward<Args>(args)...));
+    ++_size;
+}
+
+template<typename Type, typename Comparator, typename Allocator>
+void PairingHeap<Type, Comparator, Allocator>::merge(PairingHeap &other) {
+    if (this == &other)
+        return;
+
+    if constexpr (!AllocatorTraits::is_always_equal::value) {
+        if (pool.get_allocator() != other.pool.get_allocator()) {
+            move_elements_from(other);
+            return;
+        }
+    }
+
+    pool.splice(other.pool);
+    root = link(root, other.root);
+    _size += other._size;
+    other.root = nullptr;
+    other._size = 0;
+}
+
+template<typename Type, typename Comparator, typename Allocator>
+const Type &PairingHeap<Type, Comparator, Allocator>::peek() const {
+    if (_size == 0)
+        throw std::out_of_range("Heap is empty");
+    return root->value;
+}
+
+template<typename Type, typename Comparator, typename Allocator>
+Type PairingHeap<Type, Comparator, Allocator>::pop() {
+    if (_size == 0)
+        throw std::out_of_range("Heap is empty");
+
+    Type top = std::move(root->value);
+    record_moves(1);
+    Node *children = root->child;
+    destroy_node(root);
+    root = link_pairs(children);
+    --_size;
+    return top;
+}
+
+// Makes the root that loses the comparison the first child of the other. Both must be roots, without siblings.
+template<typename Type, typename Comparator, typename Allocator>
+typename PairingHeap<Type, Comparator, Allocator>::Node *PairingHeap<Type, Comparator, Allocator>::link(Node *first,
+                                                                                                      Node *second) {
+    if (first == nullptr)
+        return second;
+    if (second == nullptr)
+        return first;
+
+    if (comparator(second->value, first->value))
+        std::swap(first, second);
+    second->sibling = first->child;
+    first->child = second;
+    return first;
+}
+
+// The two-pass pairing that gives the heap its name and its amortized bound: the children are linked by pairs from
+// left to right, then the pairs are linked into one tree from right to left. The first pass stacks the pairs through
+// their sibling pointers, so the second one finds them in reverse order.
+template<typename Type, typename Comparator, typename Allocator>
+typename PairingHeap<Type, Comparator, Allocator>::Node *
+PairingHeap<Type, Comparator, Allocator>::link_pairs(Node *first) {
+    Node *pairs = nullptr;
+    while (first != nullptr) {
+        Node *second = first->sibling;
+        Node *next = second != nullptr ? second->sibling : nullptr;
+        first->sibling = nullptr;
+        if (second != nullptr)
+            second->sibling = nullptr;
+
+        Node *pair = link(first, second);
+        pair->sibling = pairs;
+        pairs = pair;
+        first = next;
+    }
+
+    Node *result = nullptr;
+    while (pairs != nullptr) {
+        Node *next = pairs->sibling;
+        pairs->sibling = nullptr;
+        result = link(result, pairs);
+        pairs = next;
+    }
+    return result;
+}
+
+template<typename Type, typename Comparator, typename Allocator>
+ContainerStats PairingHeap<Type, Comparator, Allocator>::stats() const {
+    ContainerStats stats = detail::StatsRecorder<>::stats();
+    stats += pool.stats();
+    return stats;
+}
+
+template<typename Type, typename Comparator, typename Allocator>
+template<typename... Args>
+typename PairingHeap<Type, Comparator, Allocator>::Node *
+PairingHeap<Type, Comparator, Allocator>::create_node(Args &&...args) {
+    Node *node = pool.allocate();
+    try {
+        return new (node) Node(std::forward<Args>(args)...);
+    } catch (...) {
+        pool.deallocate(node);
+        throw;
+    }
+}
+
+template<typename Type, typename Comparator, typename Allocator>
+void PairingHeap<Type, Comparator, Allocator>::destroy_node(Node *node) noexcept {
+    node->~Node();
+    pool.deallocate(node);
+}
+
+// Destroys the tree without recursion or stack: whenever the current node has a child, the child is rotated above it,
+// until the current node has none left and can go.
+template<typename Type, typename Comparator, typename Allocator>
+void PairingHeap<Type, Comparator, Allocator>::destroy_nodes() noexcept {
+    Node *node = root;
+    while (node != nullptr) {
+        if (node->child != nullptr) {
+            Node *child = node->child;
+            node->child = child->sibling;
+            child->sibling = node;
+            node = child;
+        } else {
+            Node *next = node->sibling;
+            destroy_node(node);
+            node = next;
+        }
+    }
+
+    root = nullptr;
+    _size = 0;
+}
+
+template<typename Type, typename Comparator, typename Allocator>
+void PairingHeap<Type, Comparator, Allocator>::move_elements_from(PairingHeap &other) {
+    while (!other.isEmpty())
+        push(other.pop());
+    other.pool.release();
+}
+
+#endif // PAIRING_HEAP_H
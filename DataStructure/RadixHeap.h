@@ -0,0 +1,165 @@
+#ifndef RADIX_HEAP_H
+#define RADIX_HEAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+#include "GrowthPolicy.h"
+#include "List.h"
+
+namespace detail {
+    // The number of bits needed to write value, 0 for 0, one bit at a time.
+    constexpr size_t bit_width_loop(unsigned long long value) {
+        size_t width = 0;
+        for (; value != 0; value >>= 1)
+            ++width;
+        return width;
+    }
+
+    // Counts the leading zeros in one instruction where the compiler provides it.
+    inline size_t bit_width(unsigned long long value) {
+#if defined(__GNUC__)
+        if (value == 0)
+            return 0;
+        return std::numeric_limits<unsigned long long>::digits - static_cast<size_t>(__builtin_clzll(value));
+#else
+        return bit_width_loop(value);
+#endif
+    }
+} // namespace detail
+
+// A min-heap of unsigned integers whose pops never go down: once a key was popped, no smaller key may be inserted.
+// Dijkstra with non-negative integer weights and discrete event simulations both satisfy this, and gain amortized
+// O(log C) operations made of bit tricks, C being the spread of the keys, instead of O(log n) comparisons.
+// Keys sit in buckets by the highest bit in which they differ from the last popped key. Only bucket 0, holding the
+// keys equal to it, is ever popped from; once it runs dry the lowest non-empty bucket is spread over the buckets below,
+// around its minimum, which every key moved at most bits times over its life.
+// Associated data can be packed in the low bits of the key, e.g. (distance << 32) | node.
+template<typename Key = uint64_t, typename Allocator = std::allocator<Key>>
+class RadixHeap {
+    static_assert(std::is_unsigned_v<Key> && sizeof(Key) <= sizeof(unsigned long long),
+                  "RadixHeap keys must be unsigned integers no wider than unsigned long long");
+
+public:
+    RadixHeap() : RadixHeap(Allocator()) {}
+    explicit RadixHeap(const Allocator &allocator);
+
+    void insert(Key key);
+    void push(Key key) { insert(key); }
+
+    // Constant time while keys equal to the last popped one remain, otherwise linear in the lowest non-empty bucket.
+    Key peek() const;
+    Key pop();
+
+    [[nodiscard]] bool isEmpty() const { return _size == 0; }
+    [[nodiscard]] size_t size() const { return _size; }
+    // The key pops and inserts must not go below.
+    [[nodiscard]] Key last() const { return _last; }
+    // The buffers of the buckets and of the list holding them, and the keys copied and moved through them.
+    [[nodiscard]] ContainerStats stats() const;
+
+private:
+    static constexpr size_t bits = std::numeric_limits<Key>::digits;
+
+    // Buckets keep their buffers when emptied, since they fill up again and again.
+    using Bucket = List<Key, Allocator, NeverShrink<>>;
+    using BucketAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Bucket>;
+
+    [[nodiscard]] size_t bucket_of(Key key) const;
+    [[nodiscard]] size_t lowest_bucket() const;
+    void refill();
+
+    List<Bucket, BucketAllocator> buckets;
+    Key _last = 0;
+    size_t _size = 0;
+};
+
+template<typename Key, typename Allocator>
+RadixHeap<Key, Allocator>::RadixHeap(const Allocator &allocator) : buckets(BucketAllocator(allocator)) {
+    buckets.reserve(bits + 1);
+    for (size_t index = 0; index <= bits; ++index)
+        buckets.emplace_back(allocator);
+}
+
+template<typename Key, typename Allocator>
+void RadixHeap<Key, Allocator>::insert(Key key) {
+    if (key < _last)
+        throw std::invalid_argument("RadixHeap key below the last popped key");
+
+    buckets[bucket_of(key)].push_back(key);
+    ++_size;
+}
+
+template<typename Key, typename Allocator>
+Key RadixHeap<Key, Allocator>::peek() const {
+    if (_size == 0)
+        throw std::out_of_range("Heap is empty");
+    if (!buckets[0].is_empty())
+        return _last;
+
+    const auto &bucket = buckets[lowest_bucket()];
+    Key minimum = bucket[0];
+    for (size_t index = 1; index < bucket.size(); ++index) {
+        if (bucket[index] < minimum)
+            minimum = bucket[index];
+    }
+    return minimum;
+}
+
+template<typename Key, typename Allocator>
+Key RadixHeap<Key, Allocator>::pop() {
+    if (_size == 0)
+        throw std::out_of_range("Heap is empty");
+    if (buckets[0].is_empty())
+        refill();
+
+    buckets[0].pop_back();
+    --_size;
+    return _last;
+}
+
+// Keys equal to _last go to bucket 0 and the others to the position of the highest bit they differ from it in, plus 1.
+template<typename Key, typename Allocator>
+size_t RadixHeap<Key, Allocator>::bucket_of(Key key) const {
+    return detail::bit_width(static_cast<unsigned long long>(key ^ _last));
+}
+
+template<typename Key, typename Allocator>
+ContainerStats RadixHeap<Key, Allocator>::stats() const {
+    ContainerStats stats = buckets.stats();
+    for (const Bucket &bucket: buckets)
+        stats += bucket.stats();
+    return stats;
+}
+
+template<typename Key, typename Allocator>
+size_t RadixHeap<Key, Allocator>::lowest_bucket() const {
+    size_t index = 1;
+    while (buckets[index].is_empty())
+        ++index;
+    return index;
+}
+
+// Keys of bucket i share their bits above i - 1 with _last and all differ from it in bit i - 1, so they also share it
+// with each other. Relative to their minimum, each one therefore lands in a bucket below i.
+template<typename Key, typename Allocator>
+void RadixHeap<Key, Allocator>::refill() {
+    auto &bucket = buckets[lowest_bucket()];
+
+    Key minimum = bucket[0];
+    for (size_t index = 1; index < bucket.size(); ++index) {
+        if (bucket[index] < minimum)
+            minimum = bucket[index];
+    }
+
+    _last = minimum;
+    for (size_t index = 0; index < bucket.size(); ++index)
+        buckets[bucket_of(bucket[index])].push_back(bucket[index]);
+    bucket.resize(0);
+}
+
+#endif // RADIX_HEAP_H
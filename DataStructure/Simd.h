@@ -0,0 +1,469 @@
+#ifndef SIMD_H
+#define SIMD_H
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define SIMD_X86_64 1
+#include <immintrin.h>
+#endif
+
+// Search and reduction algorithms over containers storing their elements contiguously (List, SmallList, Array), e.g.
+//     simd::find(list, 42) or simd::sum(array)
+// 32 and 64-bit integers, float and double are processed with AVX2 when the processor supports it and SSE2 otherwise,
+// every other element type (bool included, and every other architecture) takes a plain loop.
+// Positions are returned as indices, and as the container size when there is no such element.
+// Vectorized float sums add the elements in a different order than a loop would, so their rounding may differ, and
+// integer sums wrap around on overflow. min_element and max_element are unspecified for floats holding NaN.
+namespace detail::simd {
+
+    enum class Reduction { min, max, sum };
+
+    template<typename Container>
+    using element_t = std::remove_const_t<std::remove_pointer_t<decltype(std::declval<const Container &>().data())>>;
+
+    template<Reduction reduction, typename Type>
+    Type combine(Type a, Type b) {
+        if constexpr (reduction == Reduction::min) {
+            return b < a ? b : a;
+        } else if constexpr (reduction == Reduction::max) {
+            return a < b ? b : a;
+        } else if constexpr (std::is_integral_v<Type> && !std::is_same_v<Type, bool>) {
+            using Unsigned = std::make_unsigned_t<Type>;
+            return static_cast<Type>(static_cast<Unsigned>(a) + static_cast<Unsigned>(b));
+        } else {
+            return a + b;
+        }
+    }
+
+    template<typename Type>
+    size_t find_scalar(const Type *values, size_t count, const Type &value) {
+        for (size_t index = 0; index < count; ++index)
+            if (values[index] == value)
+                return index;
+        return count;
+    }
+
+    template<typename Type>
+    size_t count_scalar(const Type *values, size_t count, const Type &value) {
+        size_t matches = 0;
+        for (size_t index = 0; index < count; ++index)
+            if (values[index] == value)
+                ++matches;
+        return matches;
+    }
+
+    // Expects count > 0.
+    template<Reduction reduction, typename Type>
+    Type reduce_scalar(const Type *values, size_t count) {
+        Type result = values[0];
+        for (size_t index = 1; index < count; ++index)
+            result = combine<reduction>(result, values[index]);
+        return result;
+    }
+
+#ifdef SIMD_X86_64
+    // Integers are grouped by lane width and signedness rather than by type, so that long and long long, or int and
+    // char32_t, share their kernels. bool is left to the loop.
+    template<typename Type, size_t size>
+    constexpr bool is_integer_lane_v =
+            std::is_integral_v<Type> && !std::is_same_v<Type, bool> && sizeof(Type) == size;
+
+    template<typename Type>
+    constexpr bool is_vectorized_v = std::is_same_v<Type, float> || std::is_same_v<Type, double> ||
+                                     is_integer_lane_v<Type, 4> || is_integer_lane_v<Type, 8>;
+
+    inline bool has_avx2() {
+        static const bool supported = __builtin_cpu_supports("avx2");
+        return supported;
+    }
+
+    // Keeps the lanes of a where mask is set, and those of b elsewhere.
+    inline __m128i select_sse2(__m128i mask, __m128i a, __m128i b) {
+        return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+    }
+
+    // SSE2 only compares signed 32-bit lanes. The 64-bit comparison combines the comparison of the high halves with
+    // that of the low halves, which bias turns into an unsigned one (and the high halves too for unsigned lanes).
+    inline __m128i greater_epi64_sse2(__m128i a, __m128i b, __m128i bias) {
+        a = _mm_xor_si128(a, bias);
+        b = _mm_xor_si128(b, bias);
+        const __m128i greater = _mm_cmpgt_epi32(a, b);
+        const __m128i equal = _mm_cmpeq_epi32(a, b);
+        const __m128i high_greater = _mm_shuffle_epi32(greater, _MM_SHUFFLE(3, 3, 1, 1));
+        const __m128i high_equal = _mm_shuffle_epi32(equal, _MM_SHUFFLE(3, 3, 1, 1));
+        const __m128i low_greater = _mm_shuffle_epi32(greater, _MM_SHUFFLE(2, 2, 0, 0));
+        return _mm_or_si128(high_greater, _mm_and_si128(high_equal, low_greater));
+    }
+
+    // Each Ops struct wraps the intrinsics of one instruction set for one lane type, so that the kernels below are
+    // written once per instruction set. equal_mask returns one bit per lane.
+    template<typename Type, typename = void>
+    struct Sse2;
+
+    template<typename Type>
+    struct Sse2<Type, std::enable_if_t<is_integer_lane_v<Type, 4>>> {
+        using Vector = __m128i;
+        static constexpr size_t width = 4;
+
+        static Vector load(const Type *values) { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(values)); }
+        static void store(Type *values, Vector vector) {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(values), vector);
+        }
+        static Vector broadcast(Type value) { return _mm_set1_epi32(static_cast<int>(value)); }
+        static int equal_mask(Vector a, Vector b) { return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b))); }
+        static Vector add(Vector a, Vector b) { return _mm_add_epi32(a, b); }
+
+        // SSE2 has no 32-bit integer min/max, so they blend through a comparison mask. Flipping the sign bits turns
+        // the signed comparison into an unsigned one.
+        static Vector greater(Vector a, Vector b) {
+            if constexpr (std::is_signed_v<Type>)
+                return _mm_cmpgt_epi32(a, b);
+            const Vector bias = _mm_set1_epi32(static_cast<int>(0x80000000u));
+            return _mm_cmpgt_epi32(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias));
+        }
+        static Vector min(Vector a, Vector b) { return select_sse2(greater(a, b), b, a); }
+        static Vector max(Vector a, Vector b) { return select_sse2(greater(a, b), a, b); }
+    };
+
+    template<typename Type>
+    struct Sse2<Type, std::enable_if_t<is_integer_lane_v<Type, 8>>> {
+        using Vector = __m128i;
+        static constexpr size_t width = 2;
+
+        static Vector load(const Type *values) { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(values)); }
+        static void store(Type *values, Vector vector) {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(values), vector);
+        }
+        static Vector broadcast(Type value) { return _mm_set1_epi64x(static_cast<long long>(value)); }
+
+        // SSE2 only compares 32-bit lanes: both halves of a 64-bit lane must match.
+        static int equal_mask(Vector a, Vector b) {
+            const Vector equal = _mm_cmpeq_epi32(a, b);
+            const Vector swapped = _mm_shuffle_epi32(equal, _MM_SHUFFLE(2, 3, 0, 1));
+            return _mm_movemask_pd(_mm_castsi128_pd(_mm_and_si128(equal, swapped)));
+        }
+        static Vector add(Vector a, Vector b) { return _mm_add_epi64(a, b); }
+
+        static Vector greater(Vector a, Vector b) {
+            const unsigned long long bias = std::is_signed_v<Type> ? 0x80000000ull : 0x8000000080000000ull;
+            return greater_epi64_sse2(a, b, _mm_set1_epi64x(static_cast<long long>(bias)));
+        }
+        static Vector min(Vector a, Vector b) { return select_sse2(greater(a, b), b, a); }
+        static Vector max(Vector a, Vector b) { return select_sse2(greater(a, b), a, b); }
+    };
+
+    template<>
+    struct Sse2<float> {
+        using Vector = __m128;
+        static constexpr size_t width = 4;
+
+        static Vector load(const float *values) { return _mm_loadu_ps(values); }
+        static void store(float *values, Vector vector) { _mm_storeu_ps(values, vector); }
+        static Vector broadcast(float value) { return _mm_set1_ps(value); }
+        static int equal_mask(Vector a, Vector b) { return _mm_movemask_ps(_mm_cmpeq_ps(a, b)); }
+        static Vector add(Vector a, Vector b) { return _mm_add_ps(a, b); }
+        static Vector min(Vector a, Vector b) { return _mm_min_ps(a, b); }
+        static Vector max(Vector a, Vector b) { return _mm_max_ps(a, b); }
+    };
+
+    template<>
+    struct Sse2<double> {
+        using Vector = __m128d;
+        static constexpr size_t width = 2;
+
+        static Vector load(const double *values) { return _mm_loadu_pd(values); }
+        static void store(double *values, Vector vector) { _mm_storeu_pd(values, vector); }
+        static Vector broadcast(double value) { return _mm_set1_pd(value); }
+        static int equal_mask(Vector a, Vector b) { return _mm_movemask_pd(_mm_cmpeq_pd(a, b)); }
+        static Vector add(Vector a, Vector b) { return _mm_add_pd(a, b); }
+        static Vector min(Vector a, Vector b) { return _mm_min_pd(a, b); }
+        static Vector max(Vector a, Vector b) { return _mm_max_pd(a, b); }
+    };
+
+    template<typename Type, typename = void>
+    struct Avx2;
+
+    template<typename Type>
+    struct Avx2<Type, std::enable_if_t<is_integer_lane_v<Type, 4>>> {
+        using Vector = __m256i;
+        static constexpr size_t width = 8;
+
+        __attribute__((target("avx2"))) static Vector load(const Type *values) {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values));
+        }
+        __attribute__((target("avx2"))) static void store(Type *values, Vector vector) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(values), vector);
+        }
+        __attribute__((target("avx2"))) static Vector broadcast(Type value) {
+            return _mm256_set1_epi32(static_cast<int>(value));
+        }
+        __attribute__((target("avx2"))) static int equal_mask(Vector a, Vector b) {
+            return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b)));
+        }
+        __attribute__((target("avx2"))) static Vector add(Vector a, Vector b) { return _mm256_add_epi32(a, b); }
+        __attribute__((target("avx2"))) static Vector min(Vector a, Vector b) {
+            if constexpr (std::is_signed_v<Type>)
+                return _mm256_min_epi32(a, b);
+            return _mm256_min_epu32(a, b);
+        }
+        __attribute__((target("avx2"))) static Vector max(Vector a, Vector b) {
+            if constexpr (std::is_signed_v<Type>)
+                return _mm256_max_epi32(a, b);
+            return _mm256_max_epu32(a, b);
+        }
+    };
+
+    // AVX2 has 64-bit comparisons but no 64-bit min/max: they blend through a comparison mask, whose sign bits are
+    // flipped for unsigned lanes.
+    template<typename Type>
+    struct Avx2<Type, std::enable_if_t<is_integer_lane_v<Type, 8>>> {
+        using Vector = __m256i;
+        static constexpr size_t width = 4;
+
+        __attribute__((target("avx2"))) static Vector load(const Type *values) {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values));
+        }
+        __attribute__((target("avx2"))) static void store(Type *values, Vector vector) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(values), vector);
+        }
+        __attribute__((target("avx2"))) static Vector broadcast(Type value) {
+            return _mm256_set1_epi64x(static_cast<long long>(value));
+        }
+        __attribute__((target("avx2"))) static int equal_mask(Vector a, Vector b) {
+            return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(a, b)));
+        }
+        __attribute__((target("avx2"))) static Vector add(Vector a, Vector b) { return _mm256_add_epi64(a, b); }
+        __attribute__((target("avx2"))) static Vector greater(Vector a, Vector b) {
+            if constexpr (std::is_signed_v<Type>)
+                return _mm256_cmpgt_epi64(a, b);
+            const Vector bias = _mm256_set1_epi64x(static_cast<long long>(0x8000000000000000ull));
+            return _mm256_cmpgt_epi64(_mm256_xor_si256(a, bias), _mm256_xor_si256(b, bias));
+        }
+        __attribute__((target("avx2"))) static Vector min(Vector a, Vector b) {
+            return _mm256_blendv_epi8(a, b, greater(a, b));
+        }
+        __attribute__((target("avx2"))) static Vector max(Vector a, Vector b) {
+            return _mm256_blendv_epi8(b, a, greater(a, b));
+        }
+    };
+
+    template<>
+    struct Avx2<float> {
+        using Vector = __m256;
+        static constexpr size_t width = 8;
+
+        __attribute__((target("avx2"))) static Vector load(const float *values) { return _mm256_loadu_ps(values); }
+        __attribute__((target("avx2"))) static void store(float *values, Vector vector) {
+            _mm256_storeu_ps(values, vector);
+        }
+        __attribute__((target("avx2"))) static Vector broadcast(float value) { return _mm256_set1_ps(value); }
+        __attribute__((target("avx2"))) static int equal_mask(Vector a, Vector b) {
+            return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ));
+        }
+        __attribute__((target("avx2"))) static Vector add(Vector a, Vector b) { return _mm256_add_ps(a, b); }
+        __attribute__((target("avx2"))) static Vector min(Vector a, Vector b) { return _mm256_min_ps(a, b); }
+        __attribute__((target("avx2"))) static Vector max(Vector a, Vector b) { return _mm256_max_ps(a, b); }
+    };
+
+    template<>
+    struct Avx2<double> {
+        using Vector = __m256d;
+        static constexpr size_t width = 4;
+
+        __attribute__((target("avx2"))) static Vector load(const double *values) { return _mm256_loadu_pd(values); }
+        __attribute__((target("avx2"))) static void store(double *values, Vector vector) {
+            _mm256_storeu_pd(values, vector);
+        }
+        __attribute__((target("avx2"))) static Vector broadcast(double value) { return _mm256_set1_pd(value); }
+        __attribute__((target("avx2"))) static int equal_mask(Vector a, Vector b) {
+            return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ));
+        }
+        __attribute__((target("avx2"))) static Vector add(Vector a, Vector b) { return _mm256_add_pd(a, b); }
+        __attribute__((target("avx2"))) static Vector min(Vector a, Vector b) { return _mm256_min_pd(a, b); }
+        __attribute__((target("avx2"))) static Vector max(Vector a, Vector b) { return _mm256_max_pd(a, b); }
+    };
+
+    // The SSE2 and AVX2 kernels only differ by their target attribute: a function cannot inline AVX2 intrinsics
+    // unless it is itself compiled for AVX2, and the SSE2 ones must run on processors without it.
+    template<typename Ops, typename Type>
+    size_t find_sse2(const Type *values, size_t count, Type value) {
+        const auto needle = Ops::broadcast(value);
+        size_t index = 0;
+        for (; index + Ops::width <= count; index += Ops::width) {
+            const int mask = Ops::equal_mask(Ops::load(values + index), needle);
+            if (mask != 0)
+                return index + __builtin_ctz(mask);
+        }
+        return index + find_scalar(values + index, count - index, value);
+    }
+
+    template<typename Ops, typename Type>
+    __attribute__((target("avx2"))) size_t find_avx2(const Type *values, size_t count, Type value) {
+        const auto needle = Ops::broadcast(value);
+        size_t index = 0;
+        for (; index + Ops::width <= count; index += Ops::width) {
+            const int mask = Ops::equal_mask(Ops::load(values + index), needle);
+            if (mask != 0)
+                return index + __builtin_ctz(mask);
+        }
+        return index + find_scalar(values + index, count - index, value);
+    }
+
+    template<typename Ops, typename Type>
+    size_t count_sse2(const Type *values, size_t count, Type value) {
+        const auto needle = Ops::broadcast(value);
+        size_t matches = 0, index = 0;
+        for (; index + Ops::width <= count; index += Ops::width)
+            matches += __builtin_popcount(Ops::equal_mask(Ops::load(values + index), needle));
+        return matches + count_scalar(values + index, count - index, value);
+    }
+
+    template<typename Ops, typename Type>
+    __attribute__((target("avx2"))) size_t count_avx2(const Type *values, size_t count, Type value) {
+        const auto needle = Ops::broadcast(value);
+        size_t matches = 0, index = 0;
+        for (; index + Ops::width <= count; index += Ops::width)
+            matches += __builtin_popcount(Ops::equal_mask(Ops::load(values + index), needle));
+        return matches + count_scalar(values + index, count - index, value);
+    }
+
+    // Expects count > 0.
+    template<Reduction reduction, typename Ops, typename Type>
+    Type reduce_sse2(const Type *values, size_t count) {
+        if (count < Ops::width)
+            return reduce_scalar<reduction>(values, count);
+
+        auto accumulator = Ops::load(values);
+        size_t index = Ops::width;
+        for (; index + Ops::width <= count; index += Ops::width) {
+            const auto vector = Ops::load(values + index);
+            if constexpr (reduction == Reduction::min)
+                accumulator = Ops::min(accumulator, vector);
+            else if constexpr (reduction == Reduction::max)
+                accumulator = Ops::max(accumulator, vector);
+            else
+                accumulator = Ops::add(accumulator, vector);
+        }
+
+        Type lanes[Ops::width];
+        Ops::store(lanes, accumulator);
+        Type result = reduce_scalar<reduction>(lanes, Ops::width);
+        for (; index < count; ++index)
+            result = combine<reduction>(result, values[index]);
+        return result;
+    }
+
+    template<Reduction reduction, typename Ops, typename Type>
+    __attribute__((target("avx2"))) Type reduce_avx2(const Type *values, size_t count) {
+        if (count < Ops::width)
+            return reduce_scalar<reduction>(values, count);
+
+        auto accumulator = Ops::load(values);
+        size_t index = Ops::width;
+        for (; index + Ops::width <= count; index += Ops::width) {
+            const auto vector = Ops::load(values + index);
+            if constexpr (reduction == Reduction::min)
+                accumulator = Ops::min(accumulator, vector);
+            else if constexpr (reduction == Reduction::max)
+                accumulator = Ops::max(accumulator, vector);
+            else
+                accumulator = Ops::add(accumulator, vector);
+        }
+
+        Type lanes[Ops::width];
+        Ops::store(lanes, accumulator);
+        Type result = reduce_scalar<reduction>(lanes, Ops::width);
+        for (; index < count; ++index)
+            result = combine<reduction>(result, values[index]);
+        return result;
+    }
+#else
+    template<typename Type>
+    constexpr bool is_vectorized_v = false;
+#endif
+
+    template<typename Type>
+    size_t find(const Type *values, size_t count, const Type &value) {
+#ifdef SIMD_X86_64
+        if constexpr (is_vectorized_v<Type>) {
+            if (has_avx2())
+                return find_avx2<Avx2<Type>>(values, count, value);
+            return find_sse2<Sse2<Type>>(values, count, value);
+        }
+#endif
+        return find_scalar(values, count, value);
+    }
+
+    template<typename Type>
+    size_t count(const Type *values, size_t count, const Type &value) {
+#ifdef SIMD_X86_64
+        if constexpr (is_vectorized_v<Type>) {
+            if (has_avx2())
+                return count_avx2<Avx2<Type>>(values, count, value);
+            return count_sse2<Sse2<Type>>(values, count, value);
+        }
+#endif
+        return count_scalar(values, count, value);
+    }
+
+    // Expects count > 0.
+    template<Reduction reduction, typename Type>
+    Type reduce(const Type *values, size_t count) {
+#ifdef SIMD_X86_64
+        if constexpr (is_vectorized_v<Type>) {
+            if (has_avx2())
+                return reduce_avx2<reduction, Avx2<Type>>(values, count);
+            return reduce_sse2<reduction, Sse2<Type>>(values, count);
+        }
+#endif
+        return reduce_scalar<reduction>(values, count);
+    }
+
+} // namespace detail::simd
+
+namespace simd {
+
+    template<typename Container>
+    size_t find(const Container &container, const detail::simd::element_t<Container> &value) {
+        return detail::simd::find(container.data(), container.size(), value);
+    }
+
+    template<typename Container>
+    bool contains(const Container &container, const detail::simd::element_t<Container> &value) {
+        return find(container, value) != container.size();
+    }
+
+    template<typename Container>
+    size_t count(const Container &container, const detail::simd::element_t<Container> &value) {
+        return detail::simd::count(container.data(), container.size(), value);
+    }
+
+    // The smallest value is computed first, then located with find.
+    template<typename Container>
+    size_t min_element(const Container &container) {
+        if (container.size() == 0)
+            return 0;
+        return find(container, detail::simd::reduce<detail::simd::Reduction::min>(container.data(), container.size()));
+    }
+
+    template<typename Container>
+    size_t max_element(const Container &container) {
+        if (container.size() == 0)
+            return 0;
+        return find(container, detail::simd::reduce<detail::simd::Reduction::max>(container.data(), container.size()));
+    }
+
+    // Returns a value-initialized element for an empty container.
+    template<typename Container>
+    detail::simd::element_t<Container> sum(const Container &container) {
+        if (container.size() == 0)
+            return detail::simd::element_t<Container>();
+        return detail::simd::reduce<detail::simd::Reduction::sum>(container.data(), container.size());
+    }
+
+} // namespace simd
+
+#endif // SIMD_H
@@ -0,0 +1,342 @@
+#ifndef SMALL_LIST_H
+#define SMALL_LIST_H
+
+#include <stdexcept>
+#include <utility>
+
+#include "ContainerStats.h"
+#include "ContiguousIterator.h"
+#include "Memory.h"
+
+// List with the first inline_capacity elements stored inside the object itself, like Array, so short lists never
+// touch the heap. Once it outgrows the inline buffer it spills to a heap buffer and then behaves like List.
+// The heap buffer is kept until clear(), which goes back to the inline storage. With DATA_STRUCTURE_STATS, stats()
+// only counts heap buffers as allocations, see ContainerStats.h.
+template<typename Type, size_t inline_capacity>
+class SmallList : private detail::StatsRecorder<> {
+    static_assert(inline_capacity > 0, "SmallList needs at least one inline slot");
+
+public:
+    using detail::StatsRecorder<>::stats;
+
+    SmallList() noexcept {}
+    ~SmallList();
+
+    SmallList(const SmallList &other);
+    SmallList &operator=(const SmallList &other);
+
+    SmallList(SmallList &&other) noexcept(std::is_nothrow_move_constructible_v<Type>);
+    SmallList &operator=(SmallList &&other) noexcept(std::is_nothrow_move_constructible_v<Type>);
+
+    void push_back(const Type &value);
+    void push_back(Type &&value);
+    template<typename... Args>
+    Type &emplace_back(Args &&...args);
+    void pop_back();
+
+    void push_front(const Type &value);
+    void push_front(Type &&value);
+    template<typename... Args>
+    Type &emplace_front(Args &&...args);
+    void pop_front();
+
+    Type &front();
+    const Type &front() const;
+    Type &back();
+    const Type &back() const;
+
+    Type &at(size_t index);
+    const Type &at(size_t index) const;
+
+    void clear();
+    [[nodiscard]] size_t size() const { return _size; }
+    [[nodiscard]] bool is_empty() const { return _size == 0; }
+    [[nodiscard]] bool is_inline() const { return values == inline_values(); }
+
+    Type &operator[](size_t index) { return values[index]; }
+    const Type &operator[](size_t index) const { return values[index]; }
+
+    Type *data() { return values; }
+    const Type *data() const { return values; }
+
+    using Iterator = ContiguousIterator<Type>;
+    using ConstIterator = ContiguousIterator<const Type>;
+
+    Iterator begin() { return Iterator(values, 0); }
+    Iterator end() { return Iterator(values, _size); }
+    ConstIterator begin() const { return ConstIterator(values, 0); }
+    ConstIterator end() const { return ConstIterator(values, _size); }
+    ConstIterator cbegin() const { return ConstIterator(values, 0); }
+    ConstIterator cend() const { return ConstIterator(values, _size); }
+
+private:
+    Type *inline_values() { return reinterpret_cast<Type *>(buffer); }
+    const Type *inline_values() const { return reinterpret_cast<const Type *>(buffer); }
+
+    void release() noexcept;
+    void take(SmallList &&other);
+    void reallocate(size_t new_capacity);
+    Type *allocate_values(size_t count);
+    void deallocate_values(Type *buffer, size_t count) noexcept;
+
+    alignas(Type) unsigned char buffer[sizeof(Type) * inline_capacity];
+    Type *values = inline_values();
+    size_t capacity = inline_capacity;
+    size_t _size = 0;
+};
+
+template<typename Type, size_t inline_capacity>
+SmallList<Type, inline_capacity>::~SmallList() {
+    release();
+}
+
+template<typename Type, size_t inline_capacity>
+SmallList<Type, inline_capacity>::SmallList(const SmallList &other) {
+    if (other._size > inline_capacity) {
+        values = allocate_values(other.capacity);
+        capacity = other.capacity;
+    }
+
+    try {
+        detail::uninitialized_copy(other.values, other._size, values);
+    } catch (...) {
+        if (!is_inline())
+            deallocate_values(values, capacity);
+        throw;
+    }
+    _size = other._size;
+    record_copies(_size);
+}
+
+template<typename Type, size_t inline_capacity>
+SmallList<Type, inline_capacity> &SmallList<Type, inline_capacity>::operator=(const SmallList &other) {
+    if (this == &other)
+        return *this;
+
+    SmallList copy(other);
+    release();
+    take(std::move(copy));
+    take_stats(copy);
+    return *this;
+}
+
+template<typename Type, size_t inline_capacity>
+SmallList<Type, inline_capacity>::SmallList(SmallList &&other) noexcept(std::is_nothrow_move_constructible_v<Type>) {
+    take(std::move(other));
+}
+
+template<typename Type, size_t inline_capacity>
+SmallList<Type, inline_capacity> &
+SmallList<Type, inline_capacity>::operator=(SmallList &&other) noexcept(std::is_nothrow_move_constructible_v<Type>) {
+    if (this == &other)
+        return *this;
+
+    release();
+    take(std::move(other));
+    return *this;
+}
+
+template<typename Type, size_t inline_capacity>
+void SmallList<Type, inline_capacity>::push_back(const Type &value) {
+    emplace_back(value);
+    record_copies(1);
+}
+
+template<typename Type, size_t inline_capacity>
+void SmallList<Type, inline_capacity>::push_back(Type &&value) {
+    emplace_back(std::move(value));
+    record_moves(1);
+}
+
+template<typename Type, size_t inline_capacity>
+template<typename... Args>
+Type &SmallList<Type, inline_capacity>::emplace_back(Args &&...args) {
+    if (_size < capacity) {
+        new (values + _size) Type(std::forward<Args>(args)...);
+        return values[_size++];
+    }
+
+    // The new element is built before the old ones are relocated, as args may refer to one of them.
+    const size_t new_capacity = capacity * 2;
+    Type *new_values = allocate_values(new_capacity);
+    try {
+        new (new_values + _size) Type(std::forward<Args>(args)...);
+    } catch (...) {
+        deallocate_values(new_values, new_capacity);
+        throw;
+    }
+
+    try {
+        detail::relocate(values, _size, new_values);
+    } catch (...) {
+        new_values[_size].~Type();
+        deallocate_values(new_values, new_capacity);
+        throw;
+    }
+    record_reallocation();
+    record_relocation<Type>(_size);
+
+    if (!is_inline())
+        deallocate_values(values, capacity);
+    values = new_values;
+    capacity = new_capacity;
+    return values[_size++];
+}
+
+template<typename Type, size_t inline_capacity>
+void SmallList<Type, inline_capacity>::pop_back() {
+    if (_size == 0)
+        return;
+
+    values[--_size].~Type();
+}
+
+template<typename Type, size_t inline_capacity>
+void SmallList<Type, inline_capacity>::push_front(const Type &value) {
+    emplace_front(value);
+    record_copies(1);
+}
+
+template<typename Type, size_t inline_capacity>
+void SmallList<Type, inline_capacity>::push_front(Type &&value) {
+    emplace_front(std::move(value));
+    record_moves(1);
+}
+
+template<typename Type, size_t inline_capacity>
+template<typename... Args>
+Type &SmallList<Type, inline_capacity>::emplace_front(Args &&...args) {
+    Type value(std::forward<Args>(args)...);
+
+    if (_size == capacity)
+        reallocate(capacity * 2);
+
+    if (_size == 0) {
+        new (values) Type(std::move(value));
+    } else {
+        detail::shift_right(values, _size);
+        values[0] = std::move(value);
+    }
+
+    record_moves(_size + 1);
+    ++_size;
+    return values[0];
+}
+
+template<typename Type, size_t inline_capacity>
+void SmallList<Type, inline_capacity>::pop_front() {
+    if (_size == 0)
+        return;
+
+    record_moves(_size - 1);
+    detail::shift_left(values, _size--);
+}
+
+template<typename Type, size_t inline_capacity>
+Type &SmallList<Type, inline_capacity>::front() {
+    if (_size == 0)
+        throw std::out_of_range("SmallList is empty");
+    return values[0];
+}
+
+template<typename Type, size_t inline_capacity>
+const Type &SmallList<Type, inline_capacity>::front() const {
+    if (_size == 0)
+        throw std::out_of_range("SmallList is empty");
+    return values[0];
+}
+
+template<typename Type, size_t inline_capacity>
+Type &SmallList<Type, inline_capacity>::back() {
+    if (_size == 0)
+        throw std::out_of_range("SmallList is empty");
+    return values[_size - 1];
+}
+
+template<typename Type, size_t inline_capacity>
+const Type &SmallList<Type, inline_capacity>::back() const {
+    if (_size == 0)
+        throw std::out_of_range("SmallList is empty");
+    return values[_size - 1];
+}
+
+template<typename Type, size_t inline_capacity>
+Type &SmallList<Type, inline_capacity>::at(size_t index) {
+    return const_cast<Type &>(static_cast<const SmallList &>(*this).at(index));
+}
+
+template<typename Type, size_t inline_capacity>
+const Type &SmallList<Type, inline_capacity>::at(size_t index) const {
+    if (index >= _size)
+        throw std::out_of_range("Index out of range");
+    return values[index];
+}
+
+template<typename Type, size_t inline_capacity>
+void SmallList<Type, inline_capacity>::clear() {
+    release();
+}
+
+// Leaves the list empty and inline, a valid state should whatever follows throw.
+template<typename Type, size_t inline_capacity>
+void SmallList<Type, inline_capacity>::release() noexcept {
+    detail::destroy(values, _size);
+    if (!is_inline())
+        deallocate_values(values, capacity);
+    values = inline_values();
+    capacity = inline_capacity;
+    _size = 0;
+}
+
+// Takes over other's elements, leaving it empty and inline. Expects this list to hold no elements nor heap buffer.
+template<typename Type, size_t inline_capacity>
+void SmallList<Type, inline_capacity>::take(SmallList &&other) {
+    if (other.is_inline()) {
+        values = inline_values();
+        capacity = inline_capacity;
+        detail::relocate(other.values, other._size, values);
+        record_relocation<Type>(other._size);
+    } else {
+        values = other.values;
+        capacity = other.capacity;
+        take_memory(other);
+    }
+
+    _size = other._size;
+    other.values = other.inline_values();
+    other.capacity = inline_capacity;
+    other._size = 0;
+}
+
+template<typename Type, size_t inline_capacity>
+void SmallList<Type, inline_capacity>::reallocate(size_t new_capacity) {
+    Type *new_values = allocate_values(new_capacity);
+    try {
+        detail::relocate(values, _size, new_values);
+    } catch (...) {
+        deallocate_values(new_values, new_capacity);
+        throw;
+    }
+    record_reallocation();
+    record_relocation<Type>(_size);
+
+    if (!is_inline())
+        deallocate_values(values, capacity);
+    values = new_values;
+    capacity = new_capacity;
+}
+
+template<typename Type, size_t inline_capacity>
+Type *SmallList<Type, inline_capacity>::allocate_values(size_t count) {
+    Type *buffer = detail::allocate<Type>(count);
+    record_allocation(count * sizeof(Type));
+    return buffer;
+}
+
+template<typename Type, size_t inline_capacity>
+void SmallList<Type, inline_capacity>::deallocate_values(Type *buffer, size_t count) noexcept {
+    record_deallocation(count * sizeof(Type));
+    detail::deallocate(buffer);
+}
+
+#endif // SMALL_LIST_H
@@ -0,0 +1,234 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "Array.h"
+#include "Heap.h"
+#include "List.h"
+
+// Binary snapshots of List, Array and Heap of trivially copyable elements: a fixed header followed by the raw bytes
+// of the elements, so that saving and loading are a single write and read, and MappedList can use a snapshot file in
+// place without reading it at all. A Heap is saved in heap order.
+// Snapshots are only meant to be read back on the same platform: elements are stored in their native representation
+// and byte order. A snapshot records the size and alignment of its elements, which loading checks, but not their type.
+
+// The header opening every snapshot.
+struct SnapshotHeader {
+    static constexpr char expected_magic[8] = {'D', 'S', 'S', 'N', 'A', 'P', '\0', '\0'};
+    // Bumped whenever the layout changes. Snapshots from a newer version are rejected.
+    static constexpr uint32_t current_version = 1;
+    // Reads back differently on a platform of the other byte order.
+    static constexpr uint32_t native_byte_order = 0x01020304;
+    // The elements start at a multiple of this offset, which MappedList relies on to use them in place.
+    static constexpr size_t data_alignment = 64;
+
+    enum class Kind : uint32_t { List = 1, Array = 2, Heap = 3 };
+
+    char magic[8];
+    uint32_t version;
+    Kind kind;
+    uint32_t byte_order;
+    uint32_t element_alignment;
+    uint64_t element_size;
+    uint64_t count;
+    uint64_t data_offset;
+};
+
+static_assert(sizeof(SnapshotHeader) == 48, "SnapshotHeader must have no padding, which would be saved uninitialized");
+
+namespace detail {
+
+    template<typename Type>
+    void check_snapshot_element() {
+        static_assert(std::is_trivially_copyable_v<Type>, "Snapshots store elements as raw bytes");
+        static_assert(alignof(Type) <= SnapshotHeader::data_alignment, "Snapshot elements are aligned to 64 bytes");
+    }
+
+    inline size_t snapshot_data_offset() {
+        constexpr size_t alignment = SnapshotHeader::data_alignment;
+        return (sizeof(SnapshotHeader) + alignment - 1) / alignment * alignment;
+    }
+
+    template<typename Type>
+    void write_snapshot(std::ostream &out, SnapshotHeader::Kind kind, const Type *values, size_t count) {
+        check_snapshot_element<Type>();
+
+        SnapshotHeader header{};
+        std::memcpy(header.magic, SnapshotHeader::expected_magic, sizeof(header.magic));
+        header.version = SnapshotHeader::current_version;
+        header.kind = kind;
+        header.byte_order = SnapshotHeader::native_byte_order;
+        header.element_alignment = alignof(Type);
+        header.element_size = sizeof(Type);
+        header.count = count;
+        header.data_offset = snapshot_data_offset();
+
+        const char padding[SnapshotHeader::data_alignment] = {};
+        out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        out.write(padding, static_cast<std::streamsize>(header.data_offset - sizeof(header)));
+        if (count > 0)
+            out.write(reinterpret_cast<const char *>(values), static_cast<std::streamsize>(count * sizeof(Type)));
+        if (!out)
+            throw std::runtime_error("Snapshot could not be written");
+    }
+
+    // Throws unless header opens a snapshot of kind, or of any kind when kind is null, whose elements have the size
+    // and alignment of Type and fit in available bytes.
+    template<typename Type>
+    void check_snapshot_header(const SnapshotHeader &header, const SnapshotHeader::Kind *kind, uint64_t available) {
+        check_snapshot_element<Type>();
+
+        if (std::memcmp(header.magic, SnapshotHeader::expected_magic, sizeof(header.magic)) != 0)
+            throw std::runtime_error("Not a snapshot");
+        if (header.version == 0 || header.version > SnapshotHeader::current_version)
+            throw std::runtime_error("Snapshot version not supported");
+        if (header.byte_order != SnapshotHeader::native_byte_order)
+            throw std::runtime_error("Snapshot saved with another byte order");
+        if (kind != nullptr && header.kind != *kind)
+            throw std::runtime_error("Snapshot holds another kind of container");
+        if (header.element_size != sizeof(Type) || header.element_alignment != alignof(Type))
+            throw std::runtime_error("Snapshot elements do not match the element type");
+        if (header.data_offset < sizeof(SnapshotHeader) || header.data_offset % SnapshotHeader::data_alignment != 0)
+            throw std::runtime_error("Snapshot is corrupted");
+        if (header.data_offset > available || header.count > (available - header.data_offset) / sizeof(Type))
+            throw std::runtime_error("Snapshot is truncated");
+    }
+
+    // Reads the header and skips to the elements. The stream's size is unknown, so the elements are checked as they
+    // are read instead.
+    template<typename Type>
+    SnapshotHeader read_snapshot_header(std::istream &in, SnapshotHeader::Kind kind) {
+        SnapshotHeader header{};
+        if (!in.read(reinterpret_cast<char *>(&header), sizeof(header)))
+            throw std::runtime_error("Snapshot is truncated");
+        check_snapshot_header<Type>(header, &kind, UINT64_MAX);
+        if (!in.ignore(static_cast<std::streamsize>(header.data_offset - sizeof(header))))
+            throw std::runtime_error("Snapshot is truncated");
+        return header;
+    }
+
+    template<typename Type>
+    void read_snapshot_values(std::istream &in, Type *values, size_t count) {
+        const auto bytes = static_cast<std::streamsize>(count * sizeof(Type));
+        if (count > 0 && !in.read(reinterpret_cast<char *>(values), bytes))
+            throw std::runtime_error("Snapshot is truncated");
+    }
+
+    // Reads by bounded batches, so that a corrupted count fails once the stream runs out instead of allocating it.
+    // push(read, fill) makes room for read more elements, which fill reads in place.
+    template<typename Push>
+    void read_snapshot_batches(std::istream &in, uint64_t count, Push push) {
+        constexpr size_t batch = 1 << 16;
+        for (uint64_t loaded = 0; loaded < count;) {
+            const size_t read = count - loaded < batch ? static_cast<size_t>(count - loaded) : batch;
+            push(read, [&in](auto *values, size_t read) { read_snapshot_values(in, values, read); });
+            loaded += read;
+        }
+    }
+
+    inline std::ofstream open_snapshot_output(const std::string &path) {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out)
+            throw std::runtime_error("Cannot create snapshot " + path);
+        return out;
+    }
+
+    inline std::ifstream open_snapshot_input(const std::string &path) {
+        std::ifstream in(path, std::ios::binary);
+        if (!in)
+            throw std::runtime_error("Cannot open snapshot " + path);
+        return in;
+    }
+
+} // namespace detail
+
+template<typename Type, typename Allocator, typename GrowthPolicy>
+void save_snapshot(std::ostream &out, const List<Type, Allocator, GrowthPolicy> &list) {
+    detail::write_snapshot(out, SnapshotHeader::Kind::List, list.data(), list.size());
+}
+
+template<typename Type, size_t size>
+void save_snapshot(std::ostream &out, const Array<Type, size> &array) {
+    detail::write_snapshot(out, SnapshotHeader::Kind::Array, array.data(), size);
+}
+
+template<typename Type, typename Comparator, typename Allocator, size_t arity>
+void save_snapshot(std::ostream &out, const Heap<Type, Comparator, Allocator, arity> &heap) {
+    detail::write_snapshot(out, SnapshotHeader::Kind::Heap, heap.data(), heap.size());
+}
+
+// Replaces the file at path, if any, by a snapshot of container.
+template<typename Container>
+void save_snapshot(const std::string &path, const Container &container) {
+    std::ofstream out = detail::open_snapshot_output(path);
+    save_snapshot(out, container);
+}
+
+// The loaders throw runtime_error when the stream does not hold a snapshot of the container they load, and leave it
+// past the snapshot otherwise, so that several snapshots can follow each other in a stream.
+
+template<typename Type, typename Allocator = std::allocator<Type>, typename GrowthPolicy = DefaultGrowth>
+List<Type, Allocator, GrowthPolicy> load_list(std::istream &in, const Allocator &allocator = Allocator()) {
+    const SnapshotHeader header = detail::read_snapshot_header<Type>(in, SnapshotHeader::Kind::List);
+    List<Type, Allocator, GrowthPolicy> list(allocator);
+    detail::read_snapshot_batches(in, header.count,
+                                  [&list](size_t read, auto fill) { list.append_uninitialized(read, fill); });
+    return list;
+}
+
+template<typename Type, size_t size>
+Array<Type, size> load_array(std::istream &in) {
+    const SnapshotHeader header = detail::read_snapshot_header<Type>(in, SnapshotHeader::Kind::Array);
+    if (header.count != size)
+        throw std::runtime_error("Snapshot holds an Array of another size");
+
+    Array<Type, size> array;
+    detail::read_snapshot_values(in, array.data(), size);
+    return array;
+}
+
+// The elements are read straight into the heap and are in heap order already, so restoring the heap leaves every one
+// of them in place.
+template<typename Type, typename Comparator = std::less<Type>, typename Allocator = std::allocator<Type>,
+         size_t arity = 2>
+Heap<Type, Comparator, Allocator, arity> load_heap(std::istream &in, Comparator comparator = Comparator(),
+                                                   const Allocator &allocator = Allocator()) {
+    const SnapshotHeader header = detail::read_snapshot_header<Type>(in, SnapshotHeader::Kind::Heap);
+    Heap<Type, Comparator, Allocator, arity> heap(comparator, allocator);
+    detail::read_snapshot_batches(in, header.count,
+                                  [&heap](size_t read, auto fill) { heap.push_uninitialized(read, fill); });
+    return heap;
+}
+
+template<typename Type, typename Allocator = std::allocator<Type>, typename GrowthPolicy = DefaultGrowth>
+List<Type, Allocator, GrowthPolicy> load_list(const std::string &path, const Allocator &allocator = Allocator()) {
+    std::ifstream in = detail::open_snapshot_input(path);
+    return load_list<Type, Allocator, GrowthPolicy>(in, allocator);
+}
+
+template<typename Type, size_t size>
+Array<Type, size> load_array(const std::string &path) {
+    std::ifstream in = detail::open_snapshot_input(path);
+    return load_array<Type, size>(in);
+}
+
+template<typename Type, typename Comparator = std::less<Type>, typename Allocator = std::allocator<Type>,
+         size_t arity = 2>
+Heap<Type, Comparator, Allocator, arity> load_heap(const std::string &path, Comparator comparator = Comparator(),
+                                                   const Allocator &allocator = Allocator()) {
+    std::ifstream in = detail::open_snapshot_input(path);
+    return load_heap<Type, Comparator, Allocator, arity>(in, comparator, allocator);
+}
+
+#endif // SNAPSHOT_H
@@ -0,0 +1,92 @@
+#ifndef TOP_K_H
+#define TOP_K_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "Heap.h"
+#include "List.h"
+
+// Keeps the k greatest elements of a stream according to Comparator (pass std::greater<> to keep the k smallest) in
+// O(k) memory, however long the stream. They sit in a heap whose top is the least of them: an element beating it
+// replaces it in a single sift down, and anything else is rejected after one comparison.
+template<typename Type, typename Comparator = std::less<Type>, typename Allocator = std::allocator<Type>>
+class TopK {
+public:
+    explicit TopK(size_t k, Comparator comparator = Comparator(), const Allocator &allocator = Allocator()) :
+        heap(k, comparator, allocator), comparator(comparator), _k(k) {}
+
+    // Both return whether value was kept.
+    bool push(const Type &value) { return offer(value); }
+    bool push(Type &&value) { return offer(std::move(value)); }
+    template<typename InputIterator>
+    void push_n(InputIterator first, size_t count);
+
+    // The least of the kept elements, which any newcomer has to beat once k of them are kept.
+    const Type &threshold() const { return heap.peek(); }
+
+    // Returns the kept elements, greatest first, and leaves the selector empty.
+    List<Type, Allocator> take();
+
+    [[nodiscard]] bool isEmpty() const { return heap.isEmpty(); }
+    [[nodiscard]] bool isFull() const { return heap.size() == _k; }
+    [[nodiscard]] size_t size() const { return heap.size(); }
+    [[nodiscard]] size_t k() const { return _k; }
+    [[nodiscard]] ContainerStats stats() const { return heap.stats(); }
+
+private:
+    template<typename Value>
+    bool offer(Value &&value);
+
+    Heap<Type, Comparator, Allocator> heap;
+    Comparator comparator;
+    size_t _k;
+};
+
+template<typename Type, typename Comparator, typename Allocator>
+template<typename Value>
+bool TopK<Type, Comparator, Allocator>::offer(Value &&value) {
+    if (!isFull()) {
+        heap.push(std::forward<Value>(value));
+        return true;
+    }
+
+    if (_k == 0 || !comparator(heap.peek(), value))
+        return false;
+    heap.replace_top(std::forward<Value>(value));
+    return true;
+}
+
+// Until k elements are kept, the batch goes into the heap at once. The rest is filtered one by one.
+template<typename Type, typename Comparator, typename Allocator>
+template<typename InputIterator>
+void TopK<Type, Comparator, Allocator>::push_n(InputIterator first, size_t count) {
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+                                    typename std::iterator_traits<InputIterator>::iterator_category>) {
+        const size_t filling = std::min(count, _k - heap.size());
+        heap.push_n(first, filling);
+        std::advance(first, filling);
+        count -= filling;
+    }
+
+    for (; count > 0; --count, ++first)
+        offer(*first);
+}
+
+template<typename Type, typename Comparator, typename Allocator>
+List<Type, Allocator> TopK<Type, Comparator, Allocator>::take() {
+    List<Type, Allocator> result(heap.get_allocator());
+    result.reserve(heap.size());
+    while (!heap.isEmpty())
+        result.push_back(heap.pop());
+
+    std::reverse(result.begin(), result.end());
+    return result;
+}
+
+#endif // TOP_K_H
@@ -0,0 +1,350 @@
+#ifndef UNROLLED_LINKEDLIST_H
+#define UNROLLED_LINKEDLIST_H
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include "Array.h"
+#include "ContainerStats.h"
+#include "NodePool.h"
+
+namespace detail {
+    // Enough elements for a node's payload to fill about two cache lines, and never less than 4.
+    template<typename Type>
+    constexpr size_t unrolled_node_capacity = std::max<size_t>(4, 128 / sizeof(Type));
+} // namespace detail
+
+// A LinkedList whose nodes each hold up to node_capacity elements in an Array, in order: a traversal reads them one
+// after the other and only follows a pointer once per node, instead of once per element, and the pointer overhead is
+// shared by the whole node. Inserting in the middle shifts the elements of a single node, splitting it in two halves
+// when it is full, and a node that falls under half full after a removal takes in the next one if they fit together.
+// Nodes also link back to the previous one, so that an emptied last node is unlinked in constant time.
+// Elements must be default constructible: the Array of a node value-initializes its unused slots, and removed elements
+// are replaced by a default value.
+// Inserting or removing an element invalidates the iterators to the elements of its node and of the next one.
+template<typename Type, size_t node_capacity = detail::unrolled_node_capacity<Type>,
+         typename Allocator = std::allocator<Type>>
+class UnrolledLinkedList : private detail::StatsRecorder<> {
+    static_assert(node_capacity >= 2, "UnrolledLinkedList nodes need room for at least two elements");
+
+public:
+    UnrolledLinkedList() = default;
+    explicit UnrolledLinkedList(const Allocator &allocator) : pool(NodeAllocator(allocator)) {}
+    ~UnrolledLinkedList() noexcept { clear(); }
+
+    UnrolledLinkedList(const UnrolledLinkedList &other) = delete;
+    UnrolledLinkedList &operator=(const UnrolledLinkedList &other) = delete;
+    UnrolledLinkedList(UnrolledLinkedList &&other) noexcept;
+    UnrolledLinkedList &operator=(UnrolledLinkedList &&other) noexcept(
+        std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value ||
+        std::allocator_traits<Allocator>::is_always_equal::value);
+
+private:
+    struct Node {
+        Array<Type, node_capacity> values;
+        size_t count = 0;
+        Node *previous = nullptr;
+        Node *next = nullptr;
+    };
+
+public:
+    template<typename TypeConstness>
+    struct IteratorTemplate {
+        explicit IteratorTemplate(Node *node, size_t index = 0) : current(node), index(index) {}
+
+        TypeConstness &operator*() const { return current->values[index]; }
+        TypeConstness *operator->() const { return &(current->values[index]); }
+
+        IteratorTemplate &operator++() {
+            if (++index == current->count) {
+                current = current->next;
+                index = 0;
+            }
+            return *this;
+        }
+
+        bool operator==(const IteratorTemplate &other) const {
+            return other.current == current && other.index == index;
+        }
+        bool operator!=(const IteratorTemplate &other) const { return !(*this == other); }
+
+    private:
+        Node *current;
+        size_t index;
+
+        friend class UnrolledLinkedList;
+    };
+
+    using Iterator = IteratorTemplate<Type>;
+    using ConstIterator = IteratorTemplate<const Type>;
+
+    void push_front(Type value);
+    void push_back(Type value);
+
+    void pop_front();
+
+    Type &front() { return head->values[0]; }
+    const Type &front() const { return head->values[0]; }
+
+    Type &back() { return tail->values[tail->count - 1]; }
+    const Type &back() const { return tail->values[tail->count - 1]; }
+
+    // Inserts value right after the element iterator points to, as LinkedList does.
+    void insert_at(const Iterator &iterator, Type value);
+    void remove(const Iterator &iterator);
+
+    void clear();
+
+    [[nodiscard]] bool is_empty() const { return head == nullptr; }
+    [[nodiscard]] size_t size() const { return _size; }
+    [[nodiscard]] Allocator get_allocator() const { return Allocator(pool.get_allocator()); }
+    // The pool's chunks along with the elements moved into, within and between nodes.
+    [[nodiscard]] ContainerStats stats() const;
+
+    Iterator begin() { return Iterator(head); }
+    Iterator end() { return Iterator(nullptr); }
+    ConstIterator begin() const { return ConstIterator(head); }
+    ConstIterator end() const { return ConstIterator(nullptr); }
+    ConstIterator cbegin() const { return ConstIterator(head); }
+    ConstIterator cend() const { return ConstIterator(nullptr); }
+
+private:
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using NodeAllocatorTraits = std::allocator_traits<NodeAllocator>;
+
+    Node *create_node(Node *previous = nullptr, Node *next = nullptr);
+    void destroy_node(Node *node) noexcept;
+
+    void insert_into(Node *node, size_t index, Type &&value);
+    void erase_from(Node *node, size_t index);
+    Node *split(Node *node);
+    void rebalance(Node *node);
+
+    NodePool<Node, NodeAllocator> pool;
+    Node *head = nullptr;
+    Node *tail = nullptr;
+    size_t _size = 0;
+};
+
+template<typename Type, size_t node_capacity, typename Allocator>
+UnrolledLinkedList<Type, node_capacity, Allocator>::UnrolledLinkedList(UnrolledLinkedList &&other) noexcept :
+    pool(std::move(other.pool)), head(other.head), tail(other.tail), _size(other._size) {
+    other.head = other.tail = nullptr;
+    other._size = 0;
+}
+
+template<typename Type, size_t node_capacity, typename Allocator>
+UnrolledLinkedList<Type, node_capacity, Allocator> &
+UnrolledLinkedList<Type, node_capacity, Allocator>::operator=(UnrolledLinkedList &&other) noexcept(
+    std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value ||
+    std::allocator_traits<Allocator>::is_always_equal::value) {
+    if (this == &other)
+        return *this;
+
+    clear();
+    if constexpr (NodeAllocatorTraits::propagate_on_container_move_assignment::value) {
+        pool = std::move(other.pool);
+    } else {
+        if constexpr (!NodeAllocatorTraits::is_always_equal::value) {
+            // other's nodes cannot be released through our allocator, so its values are copied into new nodes instead.
+            if (pool.get_allocator() != other.pool.get_allocator()) {
+                for (const Type &value: other)
+                    push_back(value);
+                record_copies(other._size);
+                other.clear();
+                return *this;
+            }
+        }
+        pool.splice(other.pool);
+    }
+
+    head = other.head;
+    tail = other.tail;
+    _size = other._size;
+
+    other.head = nullptr;
+    other.tail = nullptr;
+    other._size = 0;
+
+    return *this;
+}
+
+template<typename Type, size_t node_capacity, typename Allocator>
+void UnrolledLinkedList<Type, node_capacity, Allocator>::push_front(Type value) {
+    if (is_empty()) {
+        head = tail = create_node();
+    } else if (head->count == node_capacity) {
+        head->previous = create_node(nullptr, head);
+        head = head->previous;
+    }
+
+    insert_into(head, 0, std::move(value));
+    _size++;
+}
+
+template<typename Type, size_t node_capacity, typename Allocator>
+void UnrolledLinkedList<Type, node_capacity, Allocator>::push_back(Type value) {
+    if (is_empty()) {
+        head = tail = create_node();
+    } else if (tail->count == node_capacity) {
+        tail->next = create_node(tail);
+        tail = tail->next;
+    }
+
+    insert_into(tail, tail->count, std::move(value));
+    _size++;
+}
+
+template<typename Type, size_t node_capacity, typename Allocator>
+void UnrolledLinkedList<Type, node_capacity, Allocator>::pop_front() {
+    if (is_empty())
+        return;
+
+    erase_from(head, 0);
+    _size--;
+    rebalance(head);
+}
+
+template<typename Type, size_t node_capacity, typename Allocator>
+void UnrolledLinkedList<Type, node_capacity, Allocator>::insert_at(const Iterator &iterator, Type value) {
+    Node *node = iterator.current;
+    size_t index = iterator.index + 1;
+
+    if (node->count == node_capacity) {
+        Node *upper_half = split(node);
+        if (index > node->count) {
+            index -= node->count;
+            node = upper_half;
+        }
+    }
+
+    insert_into(node, index, std::move(value));
+    _size++;
+}
+
+template<typename Type, size_t node_capacity, typename Allocator>
+void UnrolledLinkedList<Type, node_capacity, Allocator>::remove(const Iterator &iterator) {
+    erase_from(iterator.current, iterator.index);
+    _size--;
+    rebalance(iterator.current);
+}
+
+template<typename Type, size_t node_capacity, typename Allocator>
+void UnrolledLinkedList<Type, node_capacity, Allocator>::clear() {
+    Node *current = head;
+
+    while (current != nullptr) {
+        Node *temp = current;
+        current = current->next;
+        destroy_node(temp);
+    }
+
+    head = nullptr;
+    tail = nullptr;
+    _size = 0;
+    pool.release();
+}
+
+template<typename Type, size_t node_capacity, typename Allocator>
+void UnrolledLinkedList<Type, node_capacity, Allocator>::insert_into(Node *node, size_t index, Type &&value) {
+    for (size_t position = node->count; position > index; --position)
+        node->values[position] = std::move(node->values[position - 1]);
+    node->values[index] = std::move(value);
+    record_moves(node->count - index + 1);
+    node->count++;
+}
+
+template<typename Type, size_t node_capacity, typename Allocator>
+void UnrolledLinkedList<Type, node_capacity, Allocator>::erase_from(Node *node, size_t index) {
+    for (size_t position = index + 1; position < node->count; ++position)
+        node->values[position - 1] = std::move(node->values[position]);
+    record_moves(node->count - index - 1);
+    node->values[--node->count] = Type();
+}
+
+// Moves the upper half of a full node into a new node linked right after it, and returns the new node.
+template<typename Type, size_t node_capacity, typename Allocator>
+typename UnrolledLinkedList<Type, node_capacity, Allocator>::Node *
+UnrolledLinkedList<Type, node_capacity, Allocator>::split(Node *node) {
+    Node *upper_half = create_node(node, node->next);
+    const size_t kept = node->count / 2;
+    for (size_t position = kept; position < node->count; ++position) {
+        upper_half->values[upper_half->count++] = std::move(node->values[position]);
+        node->values[position] = Type();
+    }
+    record_moves(node->count - kept);
+
+    node->count = kept;
+    node->next = upper_half;
+    if (upper_half->next != nullptr)
+        upper_half->next->previous = upper_half;
+    if (tail == node)
+        tail = upper_half;
+    return upper_half;
+}
+
+// Merges a node left under half full with the next one when their elements fit together, which also disposes of an
+// emptied node. An emptied node that no next one merges into is the last one, which is unlinked from its previous.
+template<typename Type, size_t node_capacity, typename Allocator>
+void UnrolledLinkedList<Type, node_capacity, Allocator>::rebalance(Node *node) {
+    if (node->count >= node_capacity / 2)
+        return;
+
+    Node *next = node->next;
+    if (next != nullptr && node->count + next->count <= node_capacity) {
+        for (size_t position = 0; position < next->count; ++position)
+            node->values[node->count++] = std::move(next->values[position]);
+        record_moves(next->count);
+        node->next = next->next;
+        if (node->next != nullptr)
+            node->next->previous = node;
+        if (tail == next)
+            tail = node;
+        destroy_node(next);
+        return;
+    }
+
+    if (node->count != 0)
+        return;
+
+    if (node == head) {
+        head = tail = nullptr;
+    } else {
+        tail = node->previous;
+        tail->next = nullptr;
+    }
+    destroy_node(node);
+}
+
+template<typename Type, size_t node_capacity, typename Allocator>
+ContainerStats UnrolledLinkedList<Type, node_capacity, Allocator>::stats() const {
+    ContainerStats stats = detail::StatsRecorder<>::stats();
+    stats += pool.stats();
+    return stats;
+}
+
+template<typename Type, size_t node_capacity, typename Allocator>
+typename UnrolledLinkedList<Type, node_capacity, Allocator>::Node *
+UnrolledLinkedList<Type, node_capacity, Allocator>::create_node(Node *previous, Node *next) {
+    Node *node = pool.allocate();
+    try {
+        new (node) Node();
+    } catch (...) {
+        pool.deallocate(node);
+        throw;
+    }
+    node->previous = previous;
+    node->next = next;
+    return node;
+}
+
+template<typename Type, size_t node_capacity, typename Allocator>
+void UnrolledLinkedList<Type, node_capacity, Allocator>::destroy_node(Node *node) noexcept {
+    node->~Node();
+    pool.deallocate(node);
+}
+
+#endif // UNROLLED_LINKEDLIST_H
@@ -1,4 +1,7 @@
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <string>
+
 #include "../DataStructure/Array.h"
 
 TEST(ArrayTest, Size) {
@@ -58,6 +61,18 @@ TEST(ArrayTest, CopyConstructor) {
     }
 }
 
+TEST(ArrayTest, CopyNonTriviallyCopyable) {
+    const Array<std::string, 3> original{"abc"};
+    Array<std::string, 3> copy(original);
+    Array<std::string, 3> assigned{};
+    assigned = original;
+
+    for (size_t i = 0; i < copy.size(); ++i) {
+        EXPECT_EQ(copy[i], "abc");
+        EXPECT_EQ(assigned[i], "abc");
+    }
+}
+
 TEST(ArrayTest, CopyAssignment) {
     const Array<int, 4> original{7};
     Array<int, 4> assigned{};
@@ -66,4 +81,64 @@ TEST(ArrayTest, CopyAssignment) {
     for (int i : assigned) {
         EXPECT_EQ(i, 7);
     }
-}
\ No newline at end of file
+}
+TEST(ArrayTest, StandardAlgorithms) {
+    Array<int, 5> array{};
+    for (size_t i = 0; i < array.size(); ++i)
+        array[i] = static_cast<int>(array.size() - i);
+
+    std::sort(array.begin(), array.end());
+
+    EXPECT_TRUE(std::is_sorted(array.cbegin(), array.cend()));
+    EXPECT_EQ(std::distance(array.begin(), std::find(array.begin(), array.end(), 3)), 2);
+    std::reverse(array.begin(), array.end());
+    EXPECT_EQ(array[0], 5);
+}
+
+constexpr Array<int, 10> squares() {
+    Array<int, 10> table{};
+    for (size_t i = 0; i < table.size(); ++i)
+        table[i] = static_cast<int>(i * i);
+    return table;
+}
+
+constexpr int sum(const Array<int, 10> &table) {
+    int total = 0;
+    for (int value: table)
+        total += value;
+    return total;
+}
+
+TEST(ArrayConstexprTest, BuildsTablesAtCompileTime) {
+    static constexpr Array<int, 10> table = squares();
+    static_assert(table[3] == 9);
+    static_assert(table.at(9) == 81);
+    static_assert(sum(table) == 285);
+    static_assert(*(table.begin() + 4) == 16);
+
+    EXPECT_EQ(table[5], 25);
+}
+
+TEST(ArrayConstexprTest, ElementWiseConstruction) {
+    constexpr Array<int, 4> partial{1, 2, 3};
+    static_assert(partial[2] == 3 && partial[3] == 0);
+
+    constexpr Array<int, 3> filled{7};
+    static_assert(filled[0] == 7 && filled[2] == 7);
+
+    const Array<std::string, 2> strings{"a", "b"};
+    EXPECT_EQ(strings[1], "b");
+}
+
+TEST(ArrayConstexprTest, Comparison) {
+    constexpr Array<int, 3> first{1, 2, 3};
+    constexpr Array<int, 3> second{1, 2, 4};
+    static_assert(first == first);
+    static_assert(first != second);
+    static_assert(first < second && second > first);
+    static_assert(first <= first && second >= first);
+
+    Array<int, 3> copy = first;
+    copy.fill(0);
+    EXPECT_TRUE(copy < first);
+}
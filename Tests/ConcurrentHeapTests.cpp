@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+#include "../DataStructure/ConcurrentHeap.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST(ConcurrentHeapTest, StrictPopsInOrder) {
+    ConcurrentHeap<int> heap(QueueOrdering::strict);
+    for (int value: {5, 2, 9, 1, 7})
+        heap.push(value);
+
+    EXPECT_EQ(heap.shard_count(), 1);
+    EXPECT_EQ(heap.size(), 5);
+
+    int value = 0;
+    for (int expected: {1, 2, 5, 7, 9}) {
+        ASSERT_TRUE(heap.try_pop(value));
+        EXPECT_EQ(value, expected);
+    }
+    EXPECT_FALSE(heap.try_pop(value));
+    EXPECT_TRUE(heap.isEmpty());
+}
+
+TEST(ConcurrentHeapTest, RelaxedPopsEveryElement) {
+    ConcurrentHeap<int, std::greater<>> heap(QueueOrdering::relaxed, 8);
+    for (int i = 0; i < 1000; ++i)
+        heap.push(i);
+
+    std::vector<bool> seen(1000, false);
+    int value = 0;
+    while (heap.try_pop(value)) {
+        EXPECT_FALSE(seen[value]);
+        seen[value] = true;
+    }
+    for (bool popped: seen)
+        EXPECT_TRUE(popped);
+}
+
+TEST(ConcurrentHeapTest, RelaxedPopsAreNearTheTop) {
+    ConcurrentHeap<int> heap(QueueOrdering::relaxed, 4);
+    for (int i = 0; i < 10000; ++i)
+        heap.push(i);
+
+    // Each shard holds about a quarter of the values, so the best of two tops stays close to the global best.
+    int value = 0;
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_TRUE(heap.try_pop(value));
+        EXPECT_LT(value, 500);
+    }
+}
+
+TEST(ConcurrentHeapTest, ProducersAndConsumers) {
+    constexpr int producers = 4;
+    constexpr int consumers = 4;
+    constexpr int per_producer = 5000;
+
+    ConcurrentHeap<int> heap;
+    std::atomic<int> produced_done{0};
+    std::vector<std::atomic<int>> seen(producers * per_producer);
+
+    std::vector<std::thread> threads;
+    for (int producer = 0; producer < producers; ++producer) {
+        threads.emplace_back([&, producer] {
+            for (int i = 0; i < per_producer; ++i)
+                heap.push(producer * per_producer + i);
+            ++produced_done;
+        });
+    }
+    for (int consumer = 0; consumer < consumers; ++consumer) {
+        threads.emplace_back([&] {
+            int value = 0;
+            while (produced_done.load() < producers || !heap.isEmpty()) {
+                if (heap.try_pop(value))
+                    ++seen[value];
+            }
+        });
+    }
+    for (std::thread &thread: threads)
+        thread.join();
+
+    for (const std::atomic<int> &count: seen)
+        EXPECT_EQ(count.load(), 1);
+    EXPECT_TRUE(heap.isEmpty());
+}
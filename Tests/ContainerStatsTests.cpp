@@ -0,0 +1,407 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+
+#include "../DataStructure/ConcurrentHeap.h"
+#include "../DataStructure/Deque.h"
+#include "../DataStructure/DoublyLinkedList.h"
+#include "../DataStructure/Heap.h"
+#include "../DataStructure/IndexedHeap.h"
+#include "../DataStructure/LinkedList.h"
+#include "../DataStructure/List.h"
+#include "../DataStructure/PairingHeap.h"
+#include "../DataStructure/RadixHeap.h"
+#include "../DataStructure/SmallList.h"
+#include "../DataStructure/Snapshot.h"
+#include "../DataStructure/TopK.h"
+#include "../DataStructure/UnrolledLinkedList.h"
+#include "TrackedObject.h"
+
+// Built into its own executable with DATA_STRUCTURE_STATS=1, see CMakeLists.txt.
+static_assert(detail::stats_enabled, "ContainerStatsTests must be compiled with DATA_STRUCTURE_STATS=1");
+
+TEST(ContainerStatsTest, ListCountsAllocationsAndReallocations) {
+    List<int> list;
+    for (int i = 0; i < 100; ++i)
+        list.push_back(i);
+
+    // Capacities 8, 16, 32, 64 then 128.
+    const ContainerStats stats = list.stats();
+    EXPECT_EQ(stats.allocations, 5);
+    EXPECT_EQ(stats.deallocations, 4);
+    EXPECT_EQ(stats.reallocations, 4);
+    EXPECT_EQ(stats.allocated_bytes, (8 + 16 + 32 + 64 + 128) * sizeof(int));
+    EXPECT_EQ(stats.current_bytes, 128 * sizeof(int));
+    EXPECT_EQ(stats.peak_bytes, (64 + 128) * sizeof(int));
+    EXPECT_EQ(stats.copies, 100);
+    EXPECT_EQ(stats.moves, 8 + 16 + 32 + 64);
+}
+
+TEST(ContainerStatsTest, ListReserveAvoidsReallocations) {
+    List<int> list;
+    list.reserve(100);
+    for (int i = 0; i < 100; ++i)
+        list.push_back(i);
+
+    EXPECT_EQ(list.stats().allocations, 1);
+    EXPECT_EQ(list.stats().reallocations, 0);
+}
+
+TEST(ContainerStatsTest, ListTellsCopiesFromMoves) {
+    List<std::string> list;
+    list.reserve(4);
+    const std::string value = "value";
+    list.push_back(value);
+    list.push_back(std::string("other"));
+    list.emplace_back("emplaced");
+
+    EXPECT_EQ(list.stats().copies, 1);
+    EXPECT_EQ(list.stats().moves, 1);
+}
+
+TEST(ContainerStatsTest, ListCopyStartsOver) {
+    List<int> list;
+    for (int i = 0; i < 20; ++i)
+        list.push_back(i);
+
+    const ContainerStats before = list.stats();
+
+    const List<int> copy(list);
+
+    EXPECT_EQ(copy.stats().allocations, 1);
+    EXPECT_EQ(copy.stats().copies, 20);
+    EXPECT_EQ(copy.stats().reallocations, 0);
+    EXPECT_EQ(list.stats().copies, before.copies);
+}
+
+TEST(ContainerStatsTest, ListMoveHandsMemoryOver) {
+    List<int> list;
+    for (int i = 0; i < 20; ++i)
+        list.push_back(i);
+    const size_t bytes = list.stats().current_bytes;
+
+    List<int> moved(std::move(list));
+
+    EXPECT_EQ(moved.stats().current_bytes, bytes);
+    EXPECT_EQ(moved.stats().allocations, 0);
+    EXPECT_EQ(list.stats().current_bytes, 0);
+
+    moved.clear();
+    moved.shrink_to_fit();
+    EXPECT_EQ(moved.stats().current_bytes, 0);
+    EXPECT_EQ(moved.stats().deallocations, 1);
+}
+
+TEST(ContainerStatsTest, ListRelocationCopiesWhenMovingMayThrow) {
+    struct ThrowingMove {
+        ThrowingMove() = default;
+        ThrowingMove(const ThrowingMove &) = default;
+        ThrowingMove(ThrowingMove &&) noexcept(false) {}
+    };
+
+    List<ThrowingMove> list;
+    for (int i = 0; i < 9; ++i)
+        list.emplace_back();
+
+    EXPECT_EQ(list.stats().reallocations, 1);
+    EXPECT_EQ(list.stats().copies, 8);
+}
+
+TEST(ContainerStatsTest, ListCountsShifts) {
+    List<int> list;
+    list.reserve(8);
+    for (int i = 0; i < 4; ++i)
+        list.push_back(i);
+    const size_t moves = list.stats().moves;
+
+    list.pop_front();
+
+    EXPECT_EQ(list.stats().moves, moves + 3);
+}
+
+TEST(ContainerStatsTest, HeapRecordsSiftDepth) {
+    Heap<int> heap(15);
+    for (int i = 14; i >= 0; --i)
+        heap.push(i);
+
+    // Every push of a smaller value sifts it up to the root, through every level below it.
+    ContainerStats stats = heap.stats();
+    EXPECT_EQ(stats.sifts, 15);
+    EXPECT_EQ(stats.max_sift_depth, 3);
+    EXPECT_EQ(stats.sift_levels, 0 + 1 + 1 + 2 * 4 + 3 * 8);
+    EXPECT_EQ(stats.allocations, 1);
+    EXPECT_EQ(stats.copies, 15);
+    EXPECT_EQ(stats.reallocations, 0);
+
+    heap.pop();
+    stats = heap.stats();
+    EXPECT_EQ(stats.sifts, 16);
+    EXPECT_LE(stats.max_sift_depth, 3);
+}
+
+TEST(ContainerStatsTest, LoadedHeapIsReadIntoItsOwnStorage) {
+    Heap<int> heap;
+    for (int i = 0; i < 100; ++i)
+        heap.push(i);
+    std::stringstream stream;
+    save_snapshot(stream, heap);
+
+    const ContainerStats stats = load_heap<int>(stream).stats();
+    EXPECT_EQ(stats.allocations, 1);
+    EXPECT_EQ(stats.copies, 0);
+}
+
+TEST(ContainerStatsTest, WiderHeapSiftsThroughFewerLevels) {
+    Heap<int> binary;
+    DaryHeap<int, 8> wide;
+    for (int i = 1000; i > 0; --i) {
+        binary.push(i);
+        wide.push(i);
+    }
+
+    EXPECT_GT(binary.stats().max_sift_depth, wide.stats().max_sift_depth);
+    EXPECT_GT(binary.stats().sift_levels, wide.stats().sift_levels);
+}
+
+TEST(ContainerStatsTest, HeapCopyAssignmentKeepsTheCopysStats) {
+    Heap<int> heap;
+    for (int i = 0; i < 10; ++i)
+        heap.push(i);
+
+    Heap<int> copy;
+    copy = heap;
+
+    EXPECT_EQ(copy.stats().copies, 10);
+    EXPECT_EQ(copy.stats().allocations, 1);
+    EXPECT_EQ(copy.stats().current_bytes, heap.stats().current_bytes);
+}
+
+TEST(ContainerStatsTest, LinkedListCountsPoolChunks) {
+    LinkedList<int> list;
+    for (int i = 0; i < 100; ++i)
+        list.push_back(i);
+
+    // Chunks of 16, 32 then 64 nodes, each with a header slot.
+    const ContainerStats stats = list.stats();
+    EXPECT_EQ(stats.allocations, 3);
+    EXPECT_EQ(stats.moves, 100);
+    EXPECT_EQ(stats.copies, 0);
+    EXPECT_GT(stats.current_bytes, 0);
+
+    list.clear();
+    EXPECT_EQ(list.stats().current_bytes, 0);
+    EXPECT_EQ(list.stats().deallocations, 3);
+}
+
+TEST(ContainerStatsTest, RecordsElementsOfTheContainerOnly) {
+    TrackedObject::reset_counters();
+    List<TrackedObject> list;
+    list.reserve(4);
+    const TrackedObject object;
+    list.push_back(object);
+    list.push_back(TrackedObject());
+
+    EXPECT_EQ(list.stats().copies, TrackedObject::copied());
+    EXPECT_EQ(list.stats().moves, TrackedObject::moved());
+}
+
+TEST(ContainerStatsTest, LinkedListMovesEachValueIntoItsNode) {
+    TrackedObject::reset_counters();
+    LinkedList<TrackedObject> list;
+    const TrackedObject object;
+    list.push_back(object);
+    list.push_front(TrackedObject());
+    list.insert_at(list.begin(), object);
+
+    // The caller copies object into the by-value parameters, which are then moved once into their node.
+    EXPECT_EQ(list.stats().moves, 3);
+    EXPECT_EQ(list.stats().copies, 0);
+    EXPECT_EQ(TrackedObject::copied(), 2);
+    EXPECT_EQ(TrackedObject::moved(), 3);
+}
+
+TEST(ContainerStatsTest, SmallListOnlyCountsHeapBuffers) {
+    TrackedObject::reset_counters();
+    SmallList<TrackedObject, 4> list;
+    const TrackedObject object;
+    for (int i = 0; i < 4; ++i)
+        list.push_back(object);
+    EXPECT_EQ(list.stats().allocations, 0);
+
+    // Spills to 8 slots, then grows to 16.
+    for (int i = 0; i < 6; ++i)
+        list.push_back(TrackedObject());
+    const ContainerStats stats = list.stats();
+    EXPECT_EQ(stats.allocations, 2);
+    EXPECT_EQ(stats.reallocations, 2);
+    EXPECT_EQ(stats.current_bytes, 16 * sizeof(TrackedObject));
+    EXPECT_EQ(stats.copies, TrackedObject::copied());
+    EXPECT_EQ(stats.moves, TrackedObject::moved());
+
+    list.clear();
+    EXPECT_EQ(list.stats().current_bytes, 0);
+    EXPECT_EQ(list.stats().deallocations, 2);
+}
+
+TEST(ContainerStatsTest, DequeCountsAllocationsAndRelocations) {
+    TrackedObject::reset_counters();
+    Deque<TrackedObject> deque;
+    const TrackedObject object;
+    for (int i = 0; i < 50; ++i) {
+        deque.push_back(object);
+        deque.push_front(TrackedObject());
+    }
+
+    // Capacities 8, 16, 32, 64 then 128.
+    const ContainerStats stats = deque.stats();
+    EXPECT_EQ(stats.allocations, 5);
+    EXPECT_EQ(stats.reallocations, 4);
+    EXPECT_EQ(stats.current_bytes, 128 * sizeof(TrackedObject));
+    EXPECT_EQ(stats.copies, TrackedObject::copied());
+    EXPECT_EQ(stats.moves, TrackedObject::moved());
+
+    const Deque<TrackedObject> copy(deque);
+    EXPECT_EQ(copy.stats().allocations, 1);
+    EXPECT_EQ(copy.stats().copies, 100);
+}
+
+TEST(ContainerStatsTest, PairingHeapCountsPoolChunksAndElements) {
+    PairingHeap<std::string> heap;
+    const std::string value = "value";
+    for (int i = 0; i < 20; ++i)
+        heap.push(value);
+    heap.push(std::string("other"));
+    heap.pop();
+
+    // Chunks of 16 then 32 nodes.
+    const ContainerStats stats = heap.stats();
+    EXPECT_EQ(stats.allocations, 2);
+    EXPECT_EQ(stats.copies, 20);
+    EXPECT_EQ(stats.moves, 2);
+
+    PairingHeap<std::string> copy;
+    copy = heap;
+    EXPECT_EQ(copy.stats().copies, 20);
+    EXPECT_EQ(copy.stats().current_bytes, heap.stats().current_bytes);
+}
+
+TEST(ContainerStatsTest, IndexedHeapCountsElementsAndIndex) {
+    IndexedHeap<std::string> heap;
+    const std::string value = "value";
+    for (int i = 0; i < 10; ++i)
+        heap.push(value);
+    const auto handle = heap.push(std::string("other"));
+    heap.update(handle, "a");
+
+    const ContainerStats stats = heap.stats();
+    EXPECT_EQ(stats.copies, 10);
+    // The push, the update, and the 8 entries relocated when the List of entries grew.
+    EXPECT_EQ(stats.moves, 10);
+    EXPECT_EQ(stats.allocations, 4);
+
+    const IndexedHeap<std::string> copy(heap);
+    EXPECT_EQ(copy.stats().copies, 11);
+    EXPECT_EQ(copy.stats().moves, 0);
+}
+
+TEST(ContainerStatsTest, UnrolledLinkedListCountsShiftsWithinNodes) {
+    UnrolledLinkedList<int, 4> list;
+    for (int i = 0; i < 4; ++i)
+        list.push_back(i);
+    EXPECT_EQ(list.stats().moves, 4);
+
+    // Splits the full node, moving its upper half, then shifts one element to make room.
+    list.insert_at(list.begin(), 10);
+    EXPECT_EQ(list.stats().moves, 4 + 2 + 2);
+
+    // Shifts the two elements left after the front of the first node.
+    list.pop_front();
+    EXPECT_EQ(list.stats().moves, 4 + 2 + 2 + 2);
+    EXPECT_EQ(list.stats().allocations, 1);
+}
+
+TEST(ContainerStatsTest, DoublyLinkedListCountsEveryNode) {
+    DoublyLinkedList<int> list;
+    for (int i = 0; i < 10; ++i)
+        list.push_back(i);
+
+    const ContainerStats stats = list.stats();
+    EXPECT_EQ(stats.allocations, 10);
+    EXPECT_EQ(stats.moves, 10);
+    EXPECT_EQ(stats.copies, 0);
+    const size_t node_bytes = stats.current_bytes / 10;
+    EXPECT_EQ(stats.current_bytes, stats.allocated_bytes);
+
+    list.pop_front();
+    EXPECT_EQ(list.stats().deallocations, 1);
+    EXPECT_EQ(list.stats().current_bytes, 9 * node_bytes);
+}
+
+TEST(ContainerStatsTest, DoublyLinkedListSpliceHandsBytesOver) {
+    DoublyLinkedList<int> list;
+    DoublyLinkedList<int> other;
+    for (int i = 0; i < 4; ++i)
+        other.push_back(i);
+    const size_t node_bytes = other.stats().current_bytes / 4;
+
+    list.splice(list.end(), other, other.begin());
+    EXPECT_EQ(list.stats().current_bytes, node_bytes);
+    EXPECT_EQ(other.stats().current_bytes, 3 * node_bytes);
+
+    list.merge(other);
+    EXPECT_EQ(list.stats().current_bytes, 4 * node_bytes);
+    EXPECT_EQ(other.stats().current_bytes, 0);
+    EXPECT_EQ(list.stats().allocations, 0);
+}
+
+TEST(ContainerStatsTest, RadixHeapAddsUpItsBuckets) {
+    RadixHeap<uint32_t> heap;
+    const ContainerStats empty = heap.stats();
+    for (uint32_t key = 0; key < 100; ++key)
+        heap.push(key * 7 % 100);
+    while (!heap.isEmpty())
+        heap.pop();
+
+    const ContainerStats stats = heap.stats();
+    EXPECT_GT(stats.allocations, empty.allocations);
+    // Every key is copied in, then again whenever a refill spreads its bucket.
+    EXPECT_GE(stats.copies - empty.copies, 100);
+    EXPECT_GT(stats.moves, empty.moves);
+}
+
+TEST(ContainerStatsTest, TopKIsItsHeap) {
+    TopK<int> top(10);
+    for (int i = 0; i < 100; ++i)
+        top.push(i);
+
+    const ContainerStats stats = top.stats();
+    EXPECT_EQ(stats.allocations, 1);
+    // The first 10 are copied in, and the 90 others each replace the top, moved out as the newcomer moves in.
+    EXPECT_EQ(stats.copies, 10);
+    EXPECT_EQ(stats.moves, 2 * 90);
+    EXPECT_GT(stats.sifts, 0);
+}
+
+TEST(ContainerStatsTest, ConcurrentHeapAddsUpItsShards) {
+    ConcurrentHeap<int> heap(QueueOrdering::relaxed, 4);
+    for (int i = 0; i < 100; ++i)
+        heap.push(i);
+
+    const ContainerStats stats = heap.stats();
+    EXPECT_EQ(stats.sifts, 100);
+    EXPECT_GE(stats.allocations, 4);
+}
+
+TEST(ContainerStatsTest, ToJson) {
+    ContainerStats stats;
+    stats.allocations = 2;
+    stats.peak_bytes = 64;
+
+    const std::string json = stats.to_json();
+
+    EXPECT_EQ(json.front(), '{');
+    EXPECT_EQ(json.back(), '}');
+    EXPECT_NE(json.find("\"allocations\": 2"), std::string::npos);
+    EXPECT_NE(json.find("\"peak_bytes\": 64"), std::string::npos);
+    EXPECT_NE(json.find("\"max_sift_depth\": 0"), std::string::npos);
+}
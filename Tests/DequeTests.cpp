@@ -0,0 +1,205 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "../DataStructure/Deque.h"
+#include "TrackedObject.h"
+
+TEST(DequeTest, EmptyOnConstruction) {
+    const Deque<int> deque;
+
+    EXPECT_TRUE(deque.is_empty());
+    EXPECT_EQ(deque.size(), 0);
+}
+
+TEST(DequeTest, PushBackAndFront) {
+    Deque<int> deque;
+    deque.push_back(2);
+    deque.push_back(3);
+    deque.push_front(1);
+    deque.push_front(0);
+
+    EXPECT_EQ(deque.size(), 4);
+    EXPECT_EQ(deque.front(), 0);
+    EXPECT_EQ(deque.back(), 3);
+    for (size_t i = 0; i < deque.size(); ++i)
+        EXPECT_EQ(deque[i], static_cast<int>(i));
+}
+
+TEST(DequeTest, PopBothEnds) {
+    Deque<int> deque;
+    for (int i = 0; i < 5; ++i)
+        deque.push_back(i);
+
+    deque.pop_front();
+    deque.pop_back();
+
+    EXPECT_EQ(deque.size(), 3);
+    EXPECT_EQ(deque.front(), 1);
+    EXPECT_EQ(deque.back(), 3);
+}
+
+TEST(DequeTest, FrontAndBackThrowWhenEmpty) {
+    Deque<int> deque;
+
+    EXPECT_THROW(deque.front(), std::out_of_range);
+    EXPECT_THROW(deque.back(), std::out_of_range);
+}
+
+TEST(DequeTest, AtThrowsWhenIndexOutOfRange) {
+    Deque<int> deque;
+    deque.push_back(1);
+
+    EXPECT_EQ(deque.at(0), 1);
+    EXPECT_THROW(deque.at(1), std::out_of_range);
+}
+
+TEST(DequeTest, QueueUsageWrapsAround) {
+    Deque<int> deque;
+    int next_in = 0, next_out = 0;
+
+    // Keeps between 5 and 7 elements so the head walks around the buffer without ever growing it.
+    for (int round = 0; round < 1000; ++round) {
+        while (deque.size() < 7)
+            deque.push_back(next_in++);
+        while (deque.size() > 5) {
+            EXPECT_EQ(deque.front(), next_out++);
+            deque.pop_front();
+        }
+    }
+
+    for (size_t i = 0; i < deque.size(); ++i)
+        EXPECT_EQ(deque.at(i), next_out + static_cast<int>(i));
+}
+
+TEST(DequeTest, GrowWhileWrapped) {
+    Deque<int> deque;
+    for (int i = 0; i < 6; ++i)
+        deque.push_back(i);
+    for (int i = 0; i < 4; ++i)
+        deque.pop_front();
+    for (int i = 6; i < 40; ++i)
+        deque.push_back(i);
+    for (int i = 3; i >= 0; --i)
+        deque.push_front(i);
+
+    ASSERT_EQ(deque.size(), 40);
+    for (size_t i = 0; i < deque.size(); ++i)
+        EXPECT_EQ(deque[i], static_cast<int>(i));
+}
+
+TEST(DequeTest, PushFrontOwnElementWhileGrowing) {
+    Deque<std::string> deque;
+    for (int i = 0; i < 8; ++i)
+        deque.push_back(std::to_string(i));
+
+    deque.push_front(deque.back());
+
+    EXPECT_EQ(deque.size(), 9);
+    EXPECT_EQ(deque.front(), "7");
+    EXPECT_EQ(deque.at(1), "0");
+}
+
+TEST(DequeTest, CopyAndAssign) {
+    Deque<std::string> deque;
+    for (int i = 0; i < 10; ++i)
+        deque.push_front(std::to_string(i));
+
+    Deque<std::string> copy(deque);
+    Deque<std::string> assigned;
+    assigned.push_back("x");
+    assigned = deque;
+
+    for (size_t i = 0; i < deque.size(); ++i) {
+        EXPECT_EQ(copy[i], deque[i]);
+        EXPECT_EQ(assigned[i], deque[i]);
+    }
+}
+
+TEST(DequeTest, MoveOnlyElements) {
+    Deque<std::unique_ptr<int>> deque;
+    for (int i = 0; i < 20; ++i) {
+        deque.push_back(std::make_unique<int>(i));
+        deque.push_front(std::make_unique<int>(-i));
+    }
+
+    Deque<std::unique_ptr<int>> moved(std::move(deque));
+    EXPECT_EQ(*moved.front(), -19);
+    EXPECT_EQ(*moved.back(), 19);
+    EXPECT_TRUE(deque.is_empty());
+}
+
+namespace {
+    // Copies throw once copies_left runs out, and moves may throw, so relocating copies the elements.
+    struct ThrowingCopy {
+        explicit ThrowingCopy(std::string value) : value(std::move(value)) {}
+        ThrowingCopy(const ThrowingCopy &other) : value(other.value) {
+            if (copies_left == 0)
+                throw std::runtime_error("copy failed");
+            --copies_left;
+        }
+        ThrowingCopy(ThrowingCopy &&other) noexcept(false) = default;
+        ThrowingCopy &operator=(const ThrowingCopy &other) = default;
+
+        std::string value;
+        inline static size_t copies_left = SIZE_MAX;
+    };
+} // namespace
+
+// The elements wrap around the buffer, and the copy of the second run throws: the deque must be left as it was.
+TEST(DequeTest, ThrowingCopyWhileGrowingLeavesElementsIntact) {
+    Deque<ThrowingCopy> deque;
+    for (int i = 0; i < 4; ++i) {
+        deque.emplace_back("a long enough string to allocate, back " + std::to_string(i));
+        deque.emplace_front("a long enough string to allocate, front " + std::to_string(i));
+    }
+
+    ThrowingCopy::copies_left = 5;
+    EXPECT_THROW(deque.emplace_back("one more"), std::runtime_error);
+    ThrowingCopy::copies_left = SIZE_MAX;
+
+    ASSERT_EQ(deque.size(), 8);
+    EXPECT_EQ(deque.front().value, "a long enough string to allocate, front 3");
+    EXPECT_EQ(deque.back().value, "a long enough string to allocate, back 3");
+    deque.emplace_back("one more");
+    EXPECT_EQ(deque.size(), 9);
+    EXPECT_EQ(deque[4].value, "a long enough string to allocate, back 0");
+}
+
+TEST(DequeMemoryTest, NoMemoryLeaks) {
+    TrackedObject::reset_counters();
+
+    {
+        Deque<TrackedObject> deque;
+        for (int i = 0; i < 50; ++i) {
+            deque.emplace_back();
+            deque.emplace_front();
+        }
+        for (int i = 0; i < 30; ++i)
+            deque.pop_front();
+    }
+
+    EXPECT_EQ(TrackedObject::created(), TrackedObject::destroyed());
+}
+
+TEST(DequeIteratorTest, IterateAcrossWrap) {
+    Deque<int> deque;
+    for (int i = 0; i < 8; ++i)
+        deque.push_back(i);
+    deque.pop_front();
+    deque.pop_front();
+    deque.push_back(8);
+    deque.push_back(9);
+
+    int expected = 2;
+    for (int value: deque)
+        EXPECT_EQ(value, expected++);
+    EXPECT_EQ(expected, 10);
+
+    const Deque<int> &const_deque = deque;
+    expected = 2;
+    for (int value: const_deque)
+        EXPECT_EQ(value, expected++);
+}
@@ -0,0 +1,223 @@
+#include <gtest/gtest.h>
+#include "../DataStructure/DoublyLinkedList.h"
+#include "../DataStructure/MemoryResource.h"
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+template<typename Type, typename Allocator>
+static std::vector<Type> to_vector(const DoublyLinkedList<Type, Allocator> &list) {
+    std::vector<Type> values;
+    for (const Type &value: list)
+        values.push_back(value);
+    return values;
+}
+
+TEST(DoublyLinkedListTest, PushAndPopAtBothEnds) {
+    DoublyLinkedList<int> list;
+    list.push_back(2);
+    list.push_back(3);
+    list.push_front(1);
+
+    EXPECT_EQ(list.size(), 3);
+    EXPECT_EQ(list.front(), 1);
+    EXPECT_EQ(list.back(), 3);
+
+    list.pop_back();
+    EXPECT_EQ(list.back(), 2);
+    list.pop_front();
+    EXPECT_EQ(list.front(), 2);
+    list.pop_front();
+    EXPECT_TRUE(list.is_empty());
+    EXPECT_TRUE(list.begin() == list.end());
+
+    list.pop_back();
+    EXPECT_EQ(list.size(), 0);
+}
+
+TEST(DoublyLinkedListTest, IteratesBothWays) {
+    DoublyLinkedList<int> list;
+    for (int i = 0; i < 5; ++i)
+        list.push_back(i);
+
+    auto iterator = list.end();
+    for (int expected = 4; expected >= 0; --expected)
+        EXPECT_EQ(*--iterator, expected);
+    EXPECT_TRUE(iterator == list.begin());
+}
+
+TEST(DoublyLinkedListTest, InsertAndEraseAtIterators) {
+    DoublyLinkedList<std::string> list;
+    list.push_back("a");
+    list.push_back("c");
+
+    auto inserted = list.insert(++list.begin(), "b");
+    EXPECT_EQ(*inserted, "b");
+    list.insert(list.end(), "d");
+    EXPECT_EQ(to_vector(list), (std::vector<std::string>{"a", "b", "c", "d"}));
+
+    auto next = list.erase(inserted);
+    EXPECT_EQ(*next, "c");
+    next = list.erase(++next);
+    EXPECT_TRUE(next == list.end());
+    EXPECT_EQ(to_vector(list), (std::vector<std::string>{"a", "c"}));
+    EXPECT_EQ(list.back(), "c");
+    EXPECT_EQ(list.size(), 2);
+}
+
+TEST(DoublyLinkedListTest, SpliceWholeListKeepsIterators) {
+    DoublyLinkedList<int> first;
+    DoublyLinkedList<int> second;
+    first.push_back(1);
+    first.push_back(4);
+    second.push_back(2);
+    second.push_back(3);
+    auto moved = second.begin();
+
+    first.splice(++first.begin(), second);
+    EXPECT_EQ(to_vector(first), (std::vector<int>{1, 2, 3, 4}));
+    EXPECT_EQ(first.size(), 4);
+    EXPECT_TRUE(second.is_empty());
+    EXPECT_EQ(*moved, 2);
+
+    first.erase(moved);
+    EXPECT_EQ(to_vector(first), (std::vector<int>{1, 3, 4}));
+}
+
+TEST(DoublyLinkedListTest, SpliceSingleElement) {
+    DoublyLinkedList<int> first;
+    DoublyLinkedList<int> second;
+    for (int i = 0; i < 3; ++i) {
+        first.push_back(i);
+        second.push_back(10 + i);
+    }
+
+    first.splice(first.begin(), second, ++second.begin());
+    EXPECT_EQ(to_vector(first), (std::vector<int>{11, 0, 1, 2}));
+    EXPECT_EQ(to_vector(second), (std::vector<int>{10, 12}));
+    EXPECT_EQ(first.size(), 4);
+    EXPECT_EQ(second.size(), 2);
+
+    first.splice(first.end(), first, first.begin());
+    EXPECT_EQ(to_vector(first), (std::vector<int>{0, 1, 2, 11}));
+    first.splice(first.begin(), first, first.begin());
+    EXPECT_EQ(to_vector(first), (std::vector<int>{0, 1, 2, 11}));
+    EXPECT_EQ(first.size(), 4);
+}
+
+TEST(DoublyLinkedListTest, MergeSortedLists) {
+    DoublyLinkedList<std::pair<int, char>> first;
+    DoublyLinkedList<std::pair<int, char>> second;
+    for (int key: {1, 3, 3, 8})
+        first.push_back({key, 'a'});
+    for (int key: {0, 3, 5, 9, 10})
+        second.push_back({key, 'b'});
+
+    const auto by_key = [](const auto &left, const auto &right) { return left.first < right.first; };
+    first.merge(second, by_key);
+
+    const std::vector<std::pair<int, char>> expected{{0, 'b'}, {1, 'a'}, {3, 'a'}, {3, 'a'}, {3, 'b'},
+                                                     {5, 'b'}, {8, 'a'}, {9, 'b'}, {10, 'b'}};
+    EXPECT_EQ(to_vector(first), expected);
+    EXPECT_EQ(first.size(), 9);
+    EXPECT_TRUE(second.is_empty());
+    EXPECT_EQ(first.back().first, 10);
+}
+
+TEST(DoublyLinkedListTest, SortIsStableAndKeepsNodes) {
+    DoublyLinkedList<std::pair<int, int>> list;
+    std::vector<std::pair<int, int>> expected;
+    std::mt19937 engine(3);
+    for (int i = 0; i < 1000; ++i) {
+        const int key = static_cast<int>(engine() % 50);
+        list.push_back({key, i});
+        expected.emplace_back(key, i);
+    }
+
+    std::map<std::pair<int, int>, const std::pair<int, int> *> addresses;
+    for (const auto &value: list)
+        addresses[value] = &value;
+
+    const auto by_key = [](const auto &left, const auto &right) { return left.first < right.first; };
+    list.sort(by_key);
+    std::stable_sort(expected.begin(), expected.end(), by_key);
+
+    EXPECT_EQ(to_vector(list), expected);
+    for (const auto &value: list)
+        EXPECT_EQ(addresses[value], &value);
+
+    auto iterator = list.end();
+    --iterator;
+    EXPECT_EQ(*iterator, expected.back());
+    EXPECT_EQ(list.back(), expected.back());
+}
+
+TEST(DoublyLinkedListTest, SortSmallLists) {
+    DoublyLinkedList<int> list;
+    list.sort();
+    EXPECT_TRUE(list.is_empty());
+
+    list.push_back(2);
+    list.sort();
+    EXPECT_EQ(list.front(), 2);
+
+    for (int value: {5, 1, 4, 3})
+        list.push_back(value);
+    list.sort(std::greater<>());
+    EXPECT_EQ(to_vector(list), (std::vector<int>{5, 4, 3, 2, 1}));
+}
+
+TEST(DoublyLinkedListTest, MoveConstructionRelinksTheSentinel) {
+    DoublyLinkedList<int> source;
+    for (int i = 0; i < 3; ++i)
+        source.push_back(i);
+
+    DoublyLinkedList<int> moved(std::move(source));
+    EXPECT_TRUE(source.is_empty());
+    EXPECT_TRUE(source.begin() == source.end());
+
+    moved.push_back(3);
+    moved.push_front(-1);
+    EXPECT_EQ(to_vector(moved), (std::vector<int>{-1, 0, 1, 2, 3}));
+    EXPECT_EQ(*--moved.end(), 3);
+}
+
+TEST(DoublyLinkedListAllocatorTest, MoveAssignmentTakesTheNodes) {
+    PoolResource pool(64);
+    using PmrList = DoublyLinkedList<int, std::pmr::polymorphic_allocator<int>>;
+    PmrList first(&pool);
+    PmrList second(&pool);
+    for (int i = 0; i < 10; ++i)
+        second.push_back(i);
+    const int *front = &second.front();
+
+    first.push_back(100);
+    first = std::move(second);
+    EXPECT_EQ(&first.front(), front);
+    EXPECT_EQ(first.size(), 10);
+    EXPECT_TRUE(second.is_empty());
+    EXPECT_EQ(first.get_allocator().resource(), &pool);
+}
+
+TEST(DoublyLinkedListAllocatorTest, SpliceAcrossResourcesThrows) {
+    MonotonicArena first_arena;
+    MonotonicArena second_arena;
+    using PmrList = DoublyLinkedList<int, std::pmr::polymorphic_allocator<int>>;
+    PmrList first(&first_arena);
+    PmrList second(&second_arena);
+    first.push_back(1);
+    second.push_back(2);
+
+    EXPECT_THROW(first.splice(first.end(), second), std::invalid_argument);
+    EXPECT_THROW(first.merge(second), std::invalid_argument);
+    EXPECT_EQ(first.size(), 1);
+    EXPECT_EQ(second.size(), 1);
+
+    first = std::move(second);
+    EXPECT_EQ(to_vector(first), (std::vector<int>{2}));
+    EXPECT_EQ(first.get_allocator().resource(), &first_arena);
+}
@@ -0,0 +1,264 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <utility>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "../DataStructure/FileBackedList.h"
+#include "../DataStructure/MappedList.h"
+
+namespace {
+    // A list file removed at the end of the test.
+    struct TemporaryFile {
+        TemporaryFile() :
+            path((std::filesystem::temp_directory_path() /
+                  ("file_backed_list_test_" + std::to_string(reinterpret_cast<std::uintptr_t>(this)) + ".bin"))
+                     .string()) {
+            std::remove(path.c_str());
+        }
+        ~TemporaryFile() { std::remove(path.c_str()); }
+
+        std::string path;
+    };
+} // namespace
+
+TEST(FileBackedListTest, StartsEmpty) {
+    TemporaryFile file;
+    const FileBackedList<int> list(file.path);
+
+    EXPECT_TRUE(list.is_empty());
+    EXPECT_EQ(list.size(), 0);
+    EXPECT_TRUE(std::filesystem::exists(file.path));
+}
+
+TEST(FileBackedListTest, PushBackGrows) {
+    TemporaryFile file;
+    FileBackedList<int> list(file.path);
+    for (int i = 0; i < 100'000; ++i)
+        list.push_back(i);
+
+    ASSERT_EQ(list.size(), 100'000);
+    EXPECT_GE(list.capacity(), 100'000);
+    EXPECT_EQ(list.front(), 0);
+    EXPECT_EQ(list.back(), 99'999);
+    for (int i = 0; i < 100'000; i += 997)
+        EXPECT_EQ(list[i], i);
+}
+
+TEST(FileBackedListTest, PushBackOwnElementWhileGrowing) {
+    TemporaryFile file;
+    FileBackedList<int> list(file.path);
+    list.push_back(42);
+    while (list.size() < list.capacity())
+        list.push_back(0);
+
+    list.push_back(list.front());
+
+    EXPECT_EQ(list.back(), 42);
+}
+
+TEST(FileBackedListTest, PersistsAcrossReopening) {
+    TemporaryFile file;
+    {
+        FileBackedList<int64_t> list(file.path);
+        for (int64_t i = 0; i < 1000; ++i)
+            list.push_back(i * i);
+    }
+
+    FileBackedList<int64_t> list(file.path);
+    ASSERT_EQ(list.size(), 1000);
+    EXPECT_EQ(list[999], 999 * 999);
+
+    list.push_back(-1);
+    EXPECT_EQ(list.size(), 1001);
+    EXPECT_EQ(list.back(), -1);
+}
+
+TEST(FileBackedListTest, SyncRecordsTheCount) {
+    TemporaryFile file;
+    FileBackedList<int> list(file.path);
+    for (int i = 0; i < 10; ++i)
+        list.push_back(i);
+    list.sync();
+    list.push_back(10);
+
+    // Another reader only sees the elements as of the last sync().
+    const MappedList<int> mapped(file.path);
+    EXPECT_EQ(mapped.size(), 10);
+    EXPECT_EQ(mapped[9], 9);
+}
+
+TEST(FileBackedListTest, FileIsASnapshot) {
+    TemporaryFile file;
+    {
+        FileBackedList<int> list(file.path);
+        for (int i = 0; i < 50; ++i)
+            list.push_back(i);
+    }
+
+    const List<int> loaded = load_list<int>(file.path);
+    ASSERT_EQ(loaded.size(), 50);
+    EXPECT_EQ(loaded[49], 49);
+}
+
+TEST(FileBackedListTest, OpensASavedList) {
+    TemporaryFile file;
+    List<int> saved;
+    saved.push_back(1);
+    saved.push_back(2);
+    save_snapshot(file.path, saved);
+
+    FileBackedList<int> list(file.path);
+    list.push_back(3);
+
+    ASSERT_EQ(list.size(), 3);
+    EXPECT_EQ(list[0], 1);
+    EXPECT_EQ(list[2], 3);
+}
+
+TEST(FileBackedListTest, PopBackAndClear) {
+    TemporaryFile file;
+    FileBackedList<int> list(file.path);
+    list.push_back(1);
+    list.push_back(2);
+
+    list.pop_back();
+    EXPECT_EQ(list.size(), 1);
+    EXPECT_EQ(list.back(), 1);
+
+    const size_t capacity = list.capacity();
+    list.clear();
+    EXPECT_TRUE(list.is_empty());
+    EXPECT_EQ(list.capacity(), capacity);
+}
+
+TEST(FileBackedListTest, ReserveAndShrinkResizeTheFile) {
+    TemporaryFile file;
+    FileBackedList<int> list(file.path);
+    list.reserve(1000);
+    EXPECT_EQ(list.capacity(), 1000);
+    EXPECT_GE(std::filesystem::file_size(file.path), 1000 * sizeof(int));
+
+    for (int i = 0; i < 10; ++i)
+        list.push_back(i);
+    list.shrink_to_fit();
+
+    EXPECT_EQ(list.capacity(), 10);
+    EXPECT_LT(std::filesystem::file_size(file.path), 100 * sizeof(int));
+    EXPECT_EQ(list[9], 9);
+}
+
+TEST(FileBackedListTest, At) {
+    TemporaryFile file;
+    FileBackedList<int> list(file.path);
+    list.push_back(7);
+
+    EXPECT_EQ(list.at(0), 7);
+    EXPECT_THROW(list.at(1), std::out_of_range);
+}
+
+TEST(FileBackedListTest, EmptyListHasNoEnds) {
+    TemporaryFile file;
+    FileBackedList<int> list(file.path);
+
+    EXPECT_THROW(list.front(), std::out_of_range);
+    EXPECT_THROW(list.back(), std::out_of_range);
+
+    list.push_back(1);
+    list.pop_back();
+    EXPECT_THROW(std::as_const(list).back(), std::out_of_range);
+}
+
+TEST(FileBackedListTest, SortsInPlace) {
+    TemporaryFile file;
+    FileBackedList<int> list(file.path);
+    for (int i = 0; i < 1000; ++i)
+        list.push_back((i * 7919) % 1000);
+
+    std::sort(list.begin(), list.end());
+
+    EXPECT_TRUE(std::is_sorted(list.begin(), list.end()));
+}
+
+TEST(FileBackedListTest, Move) {
+    TemporaryFile file;
+    FileBackedList<int> list(file.path);
+    list.push_back(1);
+
+    FileBackedList<int> moved(std::move(list));
+    EXPECT_EQ(moved.size(), 1);
+    EXPECT_TRUE(list.is_empty());
+
+    TemporaryFile other_file;
+    FileBackedList<int> other(other_file.path);
+    other = std::move(moved);
+    EXPECT_EQ(other.front(), 1);
+}
+
+TEST(FileBackedListTest, RejectsAnotherElementType) {
+    TemporaryFile file;
+    {
+        FileBackedList<int> list(file.path);
+        list.push_back(1);
+    }
+
+    EXPECT_THROW(FileBackedList<double>{file.path}, std::runtime_error);
+}
+
+TEST(FileBackedListTest, RejectsOtherFiles) {
+    TemporaryFile file;
+    std::ofstream(file.path) << "not a list";
+
+    EXPECT_THROW(FileBackedList<int>{file.path}, std::runtime_error);
+    EXPECT_THROW(FileBackedList<int>{"/nonexistent/list.bin"}, std::system_error);
+}
+
+// The child process crashes, exiting without running the destructor, after shrinking below the synced count.
+TEST(FileBackedListTest, ReopensAfterShrinkingWithoutSync) {
+    TemporaryFile file;
+    const pid_t child = fork();
+    ASSERT_GE(child, 0);
+    if (child == 0) {
+        FileBackedList<int> list(file.path);
+        for (int i = 0; i < 100; ++i)
+            list.push_back(i);
+        list.sync();
+        for (int i = 0; i < 60; ++i)
+            list.pop_back();
+        list.shrink_to_fit();
+        _exit(0);
+    }
+    int status = 0;
+    ASSERT_EQ(waitpid(child, &status, 0), child);
+    ASSERT_TRUE(WIFEXITED(status));
+
+    const FileBackedList<int> list(file.path);
+    ASSERT_EQ(list.size(), 40);
+    EXPECT_EQ(list.back(), 39);
+    EXPECT_EQ(load_list<int>(file.path).size(), 40);
+    EXPECT_EQ(MappedList<int>(file.path).size(), 40);
+}
+
+TEST(FileBackedListTest, ClearLowersTheCountWithoutSync) {
+    TemporaryFile file;
+    const pid_t child = fork();
+    ASSERT_GE(child, 0);
+    if (child == 0) {
+        FileBackedList<int> list(file.path);
+        for (int i = 0; i < 10; ++i)
+            list.push_back(i);
+        list.sync();
+        list.clear();
+        _exit(0);
+    }
+    int status = 0;
+    ASSERT_EQ(waitpid(child, &status, 0), child);
+
+    EXPECT_TRUE(FileBackedList<int>(file.path).is_empty());
+}
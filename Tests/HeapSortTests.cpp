@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+#include "../DataStructure/Array.h"
+#include "../DataStructure/HeapSort.h"
+#include "../DataStructure/List.h"
+
+#include <algorithm>
+#include <random>
+#include <string>
+
+TEST(HeapSortTest, SortsAList) {
+    List<int> list;
+    std::mt19937 random(7);
+    for (int i = 0; i < 1000; ++i)
+        list.push_back(static_cast<int>(random() % 100));
+
+    heap::heap_sort(list);
+    EXPECT_TRUE(std::is_sorted(list.begin(), list.end()));
+}
+
+TEST(HeapSortTest, SortsWithAComparator) {
+    Array<std::string, 4> array{"b", "d", "a", "c"};
+    heap::heap_sort(array, std::greater<>());
+
+    EXPECT_EQ(array[0], "d");
+    EXPECT_EQ(array[3], "a");
+}
+
+TEST(HeapSortTest, EmptyAndSingle) {
+    List<int> list;
+    heap::heap_sort(list);
+    list.push_back(1);
+    heap::heap_sort(list);
+    EXPECT_EQ(list[0], 1);
+}
+
+TEST(PartialSortTest, SortsTheSmallestToTheFront) {
+    List<int> list;
+    for (int i = 0; i < 500; ++i)
+        list.push_back((i * 211) % 500);
+
+    heap::partial_sort(list, 10);
+    for (int i = 0; i < 10; ++i)
+        EXPECT_EQ(list[i], i);
+    EXPECT_EQ(list.size(), 500);
+
+    List<int> rest(list);
+    std::sort(rest.begin(), rest.end());
+    for (int i = 0; i < 500; ++i)
+        EXPECT_EQ(rest[i], i);
+}
+
+TEST(PartialSortTest, CountBeyondSizeSortsEverything) {
+    List<int> list;
+    for (int value: {3, 1, 2})
+        list.push_back(value);
+
+    heap::partial_sort(list, 10);
+    EXPECT_EQ(list[0], 1);
+    EXPECT_EQ(list[1], 2);
+    EXPECT_EQ(list[2], 3);
+}
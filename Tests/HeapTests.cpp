@@ -1,5 +1,15 @@
 #include <gtest/gtest.h>
 #include "../DataStructure/Heap.h"
+#include "../DataStructure/List.h"
+#include "../DataStructure/MemoryResource.h"
+#include "TrackedObject.h"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 TEST(HeapTest, InsertAndPeek) {
     Heap<int> heap(5);
@@ -77,3 +87,197 @@ TEST(HeapTest, CustomStructMinHeap) {
     EXPECT_EQ(heap.pop().name, "Alice");
     EXPECT_EQ(heap.pop().name, "Charlie");
 }
+
+TEST(HeapAllocatorTest, AllocatesFromArena) {
+    MonotonicArena arena;
+    Heap<int, std::less<>, std::pmr::polymorphic_allocator<int>> heap(10, &arena);
+
+    heap.insert(3);
+    heap.insert(1);
+    heap.insert(2);
+
+    EXPECT_EQ(arena.allocated(), 10 * sizeof(int));
+    EXPECT_EQ(heap.pop(), 1);
+    EXPECT_EQ(heap.pop(), 2);
+}
+
+TEST(HeapTest, DefaultConstructedHeapGrows) {
+    Heap<int> heap;
+    for (int i = 100; i > 0; --i)
+        heap.push(i);
+
+    EXPECT_EQ(heap.size(), 100);
+    EXPECT_FALSE(heap.isFull());
+    for (int i = 1; i <= 100; ++i)
+        EXPECT_EQ(heap.pop(), i);
+}
+
+TEST(HeapTest, RangeConstruction) {
+    const std::vector<int> source = {9, 4, 7, 1, 8, 2, 6, 3, 5, 0};
+    Heap<int> heap(source.begin(), source.end());
+
+    EXPECT_EQ(heap.size(), source.size());
+    for (int i = 0; i < 10; ++i)
+        EXPECT_EQ(heap.pop(), i);
+
+    heap.push(3);
+    EXPECT_EQ(heap.peek(), 3);
+}
+
+TEST(HeapTest, RangeConstructionFromListWithComparator) {
+    List<int> list;
+    for (int i = 0; i < 50; ++i)
+        list.push_back((i * 37) % 50);
+
+    Heap<int, std::greater<>> heap(list.begin(), list.end());
+
+    for (int i = 49; i >= 0; --i)
+        EXPECT_EQ(heap.pop(), i);
+}
+
+TEST(HeapTest, EmplaceAndMoveOnlyElements) {
+    Heap<std::unique_ptr<int>, bool (*)(const std::unique_ptr<int> &, const std::unique_ptr<int> &)> heap(
+        [](const std::unique_ptr<int> &a, const std::unique_ptr<int> &b) { return *a < *b; });
+    heap.push(std::make_unique<int>(3));
+    heap.emplace(new int(1));
+    heap.push(std::make_unique<int>(2));
+
+    EXPECT_EQ(*heap.pop(), 1);
+    EXPECT_EQ(*heap.pop(), 2);
+    EXPECT_EQ(*heap.pop(), 3);
+}
+
+TEST(HeapTest, CopyAndMove) {
+    Heap<std::string> heap;
+    heap.push("b");
+    heap.push("a");
+
+    Heap<std::string> copy(heap);
+    Heap<std::string> moved(std::move(heap));
+    EXPECT_TRUE(heap.isEmpty());
+
+    copy = moved;
+    EXPECT_EQ(copy.pop(), "a");
+    EXPECT_EQ(moved.pop(), "a");
+    EXPECT_EQ(moved.size(), 1);
+}
+
+TEST(HeapMemoryTest, SiftingNeitherCopiesNorLeaks) {
+    TrackedObject::reset_counters();
+    {
+        auto by_address = [](const TrackedObject &a, const TrackedObject &b) { return &a < &b; };
+        Heap<TrackedObject, decltype(by_address)> heap(by_address);
+        for (int i = 0; i < 20; ++i)
+            heap.emplace();
+        heap.pop();
+    }
+
+    EXPECT_EQ(TrackedObject::copied(), 0);
+    EXPECT_EQ(TrackedObject::created(), TrackedObject::destroyed());
+}
+
+template<typename HeapType>
+class DaryHeapTest : public ::testing::Test {};
+
+using DaryHeapTypes = ::testing::Types<DaryHeap<int, 2>, DaryHeap<int, 3>, DaryHeap<int, 4>, DaryHeap<int, 8>>;
+TYPED_TEST_SUITE(DaryHeapTest, DaryHeapTypes);
+
+TYPED_TEST(DaryHeapTest, PopsInOrder) {
+    TypeParam heap;
+    for (int i = 0; i < 1000; ++i)
+        heap.push((i * 7919) % 1000);
+
+    for (int i = 0; i < 1000; ++i)
+        EXPECT_EQ(heap.pop(), i);
+    EXPECT_TRUE(heap.isEmpty());
+}
+
+TYPED_TEST(DaryHeapTest, RangeConstructionPopsInOrder) {
+    std::vector<int> source;
+    for (int i = 0; i < 777; ++i)
+        source.push_back((i * 31) % 777);
+
+    TypeParam heap(source.begin(), source.end());
+    for (int i = 0; i < 777; ++i)
+        EXPECT_EQ(heap.pop(), i);
+}
+
+TEST(DaryHeapLayoutTest, SiblingsShareACacheLine) {
+    DaryHeap<int, 8> heap;
+    heap.push(0);
+
+    // The first child group starts at index 1.
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(&heap.peek() + 1) % (8 * sizeof(int)), 0);
+}
+
+TEST(DaryHeapLayoutTest, FixedCapacityWithPolymorphicAllocator) {
+    MonotonicArena arena;
+    DaryHeap<int, 4, std::greater<>, std::pmr::polymorphic_allocator<int>> heap(3, &arena);
+
+    heap.insert(1);
+    heap.insert(3);
+    heap.insert(2);
+    EXPECT_THROW(heap.insert(4), std::overflow_error);
+    EXPECT_EQ(heap.pop(), 3);
+}
+
+TEST(HeapBatchTest, PushNSmallAndLargeBatches) {
+    Heap<int> heap;
+    const std::vector<int> first = {5, 3, 8, 1};
+    const std::vector<int> second = {7, 2};
+    heap.push_n(first.begin(), first.size());
+    heap.push_n(second.begin(), second.size());
+
+    std::vector<int> popped;
+    heap.pop_n(10, std::back_inserter(popped));
+    EXPECT_EQ(popped, (std::vector<int>{1, 2, 3, 5, 7, 8}));
+    EXPECT_TRUE(heap.isEmpty());
+}
+
+TEST(HeapBatchTest, PushNIntoAFixedHeapChecksCapacityFirst) {
+    Heap<int> heap(4);
+    const int values[] = {4, 3, 2, 1, 0};
+    EXPECT_THROW(heap.push_n(values, 5), std::overflow_error);
+    EXPECT_TRUE(heap.isEmpty());
+
+    heap.push_n(values, 4);
+    EXPECT_TRUE(heap.isFull());
+    EXPECT_EQ(heap.peek(), 1);
+}
+
+TEST(HeapBatchTest, PushUninitializedWritesInPlace) {
+    Heap<int> heap;
+    heap.push(4);
+    const int values[] = {6, 2, 5};
+    heap.push_uninitialized(3, [&values](int *storage, size_t count) { std::copy_n(values, count, storage); });
+    EXPECT_THROW(heap.push_uninitialized(2, [](int *, size_t) { throw std::runtime_error("fill"); }),
+                 std::runtime_error);
+
+    std::vector<int> popped;
+    heap.pop_n(10, std::back_inserter(popped));
+    EXPECT_EQ(popped, (std::vector<int>{2, 4, 5, 6}));
+}
+
+TEST(HeapBatchTest, PopNStopsAtCount) {
+    Heap<int, std::greater<>> heap;
+    for (int i = 0; i < 10; ++i)
+        heap.push(i);
+
+    int out[3];
+    EXPECT_EQ(heap.pop_n(3, out), out + 3);
+    EXPECT_EQ(out[0], 9);
+    EXPECT_EQ(out[2], 7);
+    EXPECT_EQ(heap.size(), 7);
+}
+
+TEST(HeapBatchTest, ReplaceTop) {
+    Heap<int> heap;
+    for (int value: {4, 1, 3})
+        heap.push(value);
+
+    EXPECT_EQ(heap.replace_top(5), 1);
+    EXPECT_EQ(heap.pop(), 3);
+    EXPECT_EQ(heap.pop(), 4);
+    EXPECT_EQ(heap.pop(), 5);
+    EXPECT_THROW(heap.replace_top(0), std::out_of_range);
+}
@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+#include "../DataStructure/IndexedHeap.h"
+#include "../DataStructure/MemoryResource.h"
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+TEST(IndexedHeapTest, PopsInOrder) {
+    IndexedHeap<int> heap;
+    for (int value: {5, 2, 9, 1, 7})
+        heap.insert(value);
+
+    EXPECT_EQ(heap.size(), 5);
+    EXPECT_EQ(heap.pop(), 1);
+    EXPECT_EQ(heap.pop(), 2);
+    EXPECT_EQ(heap.pop(), 5);
+    EXPECT_EQ(heap.pop(), 7);
+    EXPECT_EQ(heap.pop(), 9);
+    EXPECT_TRUE(heap.isEmpty());
+    EXPECT_THROW(heap.pop(), std::out_of_range);
+}
+
+TEST(IndexedHeapTest, HandlesFollowTheirElements) {
+    IndexedHeap<std::string> heap;
+    auto c = heap.insert("c");
+    auto a = heap.insert("a");
+    auto b = heap.insert("b");
+
+    EXPECT_EQ(heap.get(a), "a");
+    EXPECT_EQ(heap.get(b), "b");
+    EXPECT_EQ(heap.get(c), "c");
+    EXPECT_EQ(heap.top(), a);
+}
+
+TEST(IndexedHeapTest, DecreaseKeyMovesTowardsTheTop) {
+    IndexedHeap<int> heap;
+    heap.insert(10);
+    heap.insert(20);
+    auto handle = heap.insert(30);
+
+    heap.decrease_key(handle, 5);
+    EXPECT_EQ(heap.top(), handle);
+    EXPECT_EQ(heap.peek(), 5);
+    EXPECT_THROW(heap.decrease_key(handle, 50), std::invalid_argument);
+}
+
+TEST(IndexedHeapTest, IncreaseKeyMovesAwayFromTheTop) {
+    IndexedHeap<int> heap;
+    auto handle = heap.insert(1);
+    heap.insert(20);
+    heap.insert(30);
+
+    heap.increase_key(handle, 25);
+    EXPECT_EQ(heap.pop(), 20);
+    EXPECT_EQ(heap.pop(), 25);
+    EXPECT_EQ(heap.pop(), 30);
+    EXPECT_THROW(heap.increase_key(heap.insert(4), 3), std::invalid_argument);
+}
+
+TEST(IndexedHeapTest, UpdateAndErase) {
+    IndexedHeap<int, std::greater<>> heap;
+    std::vector<IndexedHeap<int, std::greater<>>::Handle> handles;
+    for (int i = 0; i < 10; ++i)
+        handles.push_back(heap.insert(i));
+
+    heap.update(handles[2], 100);
+    heap.update(handles[9], -1);
+    heap.erase(handles[5]);
+
+    EXPECT_FALSE(heap.contains(handles[5]));
+    EXPECT_THROW(heap.erase(handles[5]), std::out_of_range);
+    EXPECT_THROW(heap.get(handles[5]), std::out_of_range);
+
+    std::vector<int> popped;
+    while (!heap.isEmpty())
+        popped.push_back(heap.pop());
+    EXPECT_EQ(popped, (std::vector<int>{100, 8, 7, 6, 4, 3, 1, 0, -1}));
+}
+
+TEST(IndexedHeapTest, HandlesAreReused) {
+    IndexedHeap<int> heap;
+    auto first = heap.insert(1);
+    heap.pop();
+
+    EXPECT_FALSE(heap.contains(first));
+    EXPECT_EQ(heap.insert(2), first);
+    EXPECT_EQ(heap.get(first), 2);
+}
+
+TEST(IndexedHeapTest, MatchesAnOrderedSet) {
+    IndexedHeap<int, std::less<int>, std::allocator<int>, 4> heap;
+    std::set<std::pair<int, size_t>> expected;
+    std::vector<size_t> live;
+    std::mt19937 random(42);
+
+    for (int step = 0; step < 5000; ++step) {
+        const auto operation = random() % 4;
+        if (live.empty() || operation == 0) {
+            const int value = static_cast<int>(random() % 1000);
+            const size_t handle = heap.insert(value);
+            expected.emplace(value, handle);
+            live.push_back(handle);
+        } else if (operation == 1) {
+            const size_t index = random() % live.size();
+            const int value = static_cast<int>(random() % 1000);
+            expected.erase({heap.get(live[index]), live[index]});
+            heap.update(live[index], value);
+            expected.emplace(value, live[index]);
+        } else if (operation == 2) {
+            const size_t index = random() % live.size();
+            expected.erase({heap.get(live[index]), live[index]});
+            heap.erase(live[index]);
+            live.erase(live.begin() + static_cast<std::ptrdiff_t>(index));
+        } else {
+            EXPECT_EQ(heap.peek(), expected.begin()->first);
+            expected.erase({heap.peek(), heap.top()});
+            live.erase(std::find(live.begin(), live.end(), heap.top()));
+            heap.pop();
+        }
+        ASSERT_EQ(heap.size(), expected.size());
+    }
+}
+
+TEST(IndexedHeapTest, ShortestPaths) {
+    const std::vector<std::vector<std::pair<size_t, int>>> graph = {
+        {{1, 4}, {2, 1}}, {{3, 1}}, {{1, 2}, {3, 5}}, {},
+    };
+    constexpr int unreachable = std::numeric_limits<int>::max();
+
+    std::vector<int> distances(graph.size(), unreachable);
+    IndexedHeap<std::pair<int, size_t>> queue;
+    std::vector<size_t> handles(graph.size());
+    distances[0] = 0;
+    for (size_t node = 0; node < graph.size(); ++node)
+        handles[node] = queue.insert({distances[node], node});
+
+    while (!queue.isEmpty()) {
+        const auto [distance, node] = queue.pop();
+        for (const auto &[next, weight]: graph[node]) {
+            if (distance != unreachable && distance + weight < distances[next]) {
+                distances[next] = distance + weight;
+                queue.decrease_key(handles[next], {distances[next], next});
+            }
+        }
+    }
+
+    EXPECT_EQ(distances, (std::vector<int>{0, 3, 1, 4}));
+}
+
+TEST(IndexedHeapAllocatorTest, AllocatesFromTheResource) {
+    MonotonicArena arena;
+    IndexedHeap<int, std::less<>, std::pmr::polymorphic_allocator<int>> heap(std::less<>(), &arena);
+    heap.insert(3);
+    heap.insert(1);
+
+    EXPECT_GT(arena.allocated(), 0);
+    EXPECT_EQ(heap.pop(), 1);
+}
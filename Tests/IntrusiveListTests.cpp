@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+#include "../DataStructure/IntrusiveList.h"
+
+#include <vector>
+
+struct ReadyTag;
+struct TimerTag;
+
+struct Task : IntrusiveListHook<>, IntrusiveListHook<ReadyTag>, IntrusiveListHook<TimerTag> {
+    explicit Task(int id) : id(id) {}
+    int id;
+};
+
+template<typename Tag>
+static std::vector<int> ids(const IntrusiveList<Task, Tag> &list) {
+    std::vector<int> values;
+    for (const Task &task: list)
+        values.push_back(task.id);
+    return values;
+}
+
+TEST(IntrusiveListTest, LinksObjectsInPlace) {
+    Task first(1), second(2), third(3);
+    IntrusiveList<Task> list;
+    EXPECT_TRUE(list.is_empty());
+
+    list.push_back(second);
+    list.push_back(third);
+    list.push_front(first);
+
+    EXPECT_EQ(list.size(), 3);
+    EXPECT_EQ(&list.front(), &first);
+    EXPECT_EQ(&list.back(), &third);
+    EXPECT_EQ(ids(list), (std::vector<int>{1, 2, 3}));
+    EXPECT_TRUE(static_cast<IntrusiveListHook<> &>(second).is_linked());
+}
+
+TEST(IntrusiveListTest, RemoveFromAnyPosition) {
+    Task tasks[] = {Task(0), Task(1), Task(2), Task(3)};
+    IntrusiveList<Task> list;
+    for (Task &task: tasks)
+        list.push_back(task);
+
+    list.remove(tasks[2]);
+    EXPECT_EQ(ids(list), (std::vector<int>{0, 1, 3}));
+    EXPECT_FALSE(static_cast<IntrusiveListHook<> &>(tasks[2]).is_linked());
+
+    list.remove(tasks[3]);
+    list.remove(tasks[0]);
+    EXPECT_EQ(ids(list), (std::vector<int>{1}));
+    EXPECT_EQ(&list.front(), &tasks[1]);
+    EXPECT_EQ(&list.back(), &tasks[1]);
+
+    list.push_back(tasks[2]);
+    EXPECT_EQ(ids(list), (std::vector<int>{1, 2}));
+}
+
+TEST(IntrusiveListTest, InsertEraseAndIterateBackwards) {
+    Task tasks[] = {Task(0), Task(1), Task(2)};
+    IntrusiveList<Task> list;
+    list.push_back(tasks[0]);
+    list.push_back(tasks[2]);
+
+    auto inserted = list.insert(list.iterator_to(tasks[2]), tasks[1]);
+    EXPECT_EQ(inserted->id, 1);
+
+    auto iterator = list.end();
+    for (int expected = 2; expected >= 0; --expected)
+        EXPECT_EQ((--iterator)->id, expected);
+
+    auto next = list.erase(list.begin());
+    EXPECT_EQ(next->id, 1);
+    list.pop_back();
+    list.pop_front();
+    EXPECT_TRUE(list.is_empty());
+    list.pop_front();
+    EXPECT_EQ(list.size(), 0);
+}
+
+TEST(IntrusiveListTest, ObjectInSeveralLists) {
+    Task tasks[] = {Task(0), Task(1), Task(2)};
+    IntrusiveList<Task, ReadyTag> ready;
+    IntrusiveList<Task, TimerTag> timers;
+    for (Task &task: tasks) {
+        ready.push_back(task);
+        timers.push_front(task);
+    }
+
+    ready.remove(tasks[1]);
+    EXPECT_EQ(ids(ready), (std::vector<int>{0, 2}));
+    EXPECT_EQ(ids(timers), (std::vector<int>{2, 1, 0}));
+}
+
+TEST(IntrusiveListTest, CopiedObjectsAreNotLinked) {
+    Task task(1);
+    IntrusiveList<Task> list;
+    list.push_back(task);
+
+    Task copy = task;
+    EXPECT_FALSE(static_cast<IntrusiveListHook<> &>(copy).is_linked());
+    list.push_back(copy);
+    EXPECT_EQ(list.size(), 2);
+}
+
+TEST(IntrusiveListTest, ClearAndDestructionUnlink) {
+    Task first(1), second(2);
+    {
+        IntrusiveList<Task> list;
+        list.push_back(first);
+        list.push_back(second);
+
+        list.clear();
+        EXPECT_TRUE(list.is_empty());
+        EXPECT_FALSE(static_cast<IntrusiveListHook<> &>(first).is_linked());
+
+        list.push_back(second);
+    }
+    EXPECT_FALSE(static_cast<IntrusiveListHook<> &>(second).is_linked());
+}
+
+TEST(IntrusiveListTest, MoveRelinksTheSentinel) {
+    Task tasks[] = {Task(0), Task(1)};
+    IntrusiveList<Task> source;
+    for (Task &task: tasks)
+        source.push_back(task);
+
+    IntrusiveList<Task> moved(std::move(source));
+    EXPECT_TRUE(source.is_empty());
+    EXPECT_EQ(ids(moved), (std::vector<int>{0, 1}));
+
+    IntrusiveList<Task> assigned;
+    assigned = std::move(moved);
+    EXPECT_TRUE(moved.is_empty());
+    assigned.remove(tasks[1]);
+    EXPECT_EQ(ids(assigned), (std::vector<int>{0}));
+    EXPECT_EQ(&assigned.back(), &tasks[0]);
+}
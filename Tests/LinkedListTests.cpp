@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 #include "../DataStructure/LinkedList.h"
+#include "../DataStructure/MemoryResource.h"
+
+#include <string>
 
 TEST(LinkedListTest, PushBackAndFront) {
     LinkedList<int> list;
@@ -57,4 +60,93 @@ TEST(LinkedListTest, ConstIteratorTraversal) {
     }
 
     EXPECT_EQ(index, 3);
-}
\ No newline at end of file
+}
+
+TEST(LinkedListAllocatorTest, NodesComeFromPool) {
+    PoolResource pool(32, 4);
+    LinkedList<int, std::pmr::polymorphic_allocator<int>> list(&pool);
+    for (int i = 0; i < 20; ++i)
+        list.push_back(i);
+
+    list.pop_front();
+    list.push_front(100);
+
+    EXPECT_EQ(list.size(), 20);
+    EXPECT_EQ(list.front(), 100);
+    EXPECT_EQ(list.back(), 19);
+    EXPECT_EQ(list.get_allocator().resource(), &pool);
+}
+
+TEST(LinkedListTest, RemoveMiddleAndTail) {
+    LinkedList<int> list;
+    list.push_back(1);
+    list.push_back(2);
+    list.push_back(3);
+
+    list.remove(++list.begin());
+    EXPECT_EQ(list.size(), 2);
+    EXPECT_EQ(list.back(), 3);
+
+    list.remove(++list.begin());
+    EXPECT_EQ(list.back(), 1);
+    list.push_back(4);
+    EXPECT_EQ(list.back(), 4);
+}
+
+TEST(LinkedListPoolTest, ConsecutiveNodesAreAdjacent) {
+    LinkedList<long> list;
+    for (long i = 0; i < 8; ++i)
+        list.push_back(i);
+
+    const long *previous = nullptr;
+    for (const long &value: list) {
+        if (previous != nullptr) {
+            EXPECT_EQ(reinterpret_cast<const char *>(&value) - reinterpret_cast<const char *>(previous),
+                      2 * sizeof(void *));
+        }
+        previous = &value;
+    }
+}
+
+TEST(LinkedListPoolTest, RemovedNodesAreReused) {
+    LinkedList<int> list;
+    list.push_back(1);
+    const int *first = &list.front();
+    list.pop_front();
+    list.push_back(2);
+
+    EXPECT_EQ(&list.front(), first);
+}
+
+TEST(LinkedListPoolTest, MoveAssignmentTakesTheNodes) {
+    PoolResource pool(64);
+    LinkedList<std::string, std::pmr::polymorphic_allocator<std::string>> first(&pool);
+    LinkedList<std::string, std::pmr::polymorphic_allocator<std::string>> second(&pool);
+    for (int i = 0; i < 50; ++i)
+        second.push_back(std::to_string(i));
+    const std::string *front = &second.front();
+
+    first.push_back("dropped");
+    first = std::move(second);
+    EXPECT_EQ(&first.front(), front);
+    EXPECT_EQ(first.size(), 50);
+    EXPECT_TRUE(second.is_empty());
+
+    second.push_back("again");
+    EXPECT_EQ(second.front(), "again");
+    EXPECT_EQ(first.back(), "49");
+}
+
+TEST(LinkedListPoolTest, MoveAssignmentAcrossResourcesCopies) {
+    MonotonicArena first_arena;
+    MonotonicArena second_arena;
+    LinkedList<int, std::pmr::polymorphic_allocator<int>> first(&first_arena);
+    LinkedList<int, std::pmr::polymorphic_allocator<int>> second(&second_arena);
+    second.push_back(1);
+    second.push_back(2);
+
+    first = std::move(second);
+    EXPECT_EQ(first.size(), 2);
+    EXPECT_EQ(first.back(), 2);
+    EXPECT_EQ(first.get_allocator().resource(), &first_arena);
+}
@@ -1,6 +1,12 @@
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 #include "../DataStructure/List.h"
+#include "../DataStructure/MemoryResource.h"
 #include "TrackedObject.h"
 
 TEST(ListTest, Size) {
@@ -143,8 +149,7 @@ TEST(ListMemoryTest, NoMemoryLeaksAfterClear) {
 
     list.clear();
 
-    // Clears keep a default space of 8
-    EXPECT_EQ(TrackedObject::created() - 8, TrackedObject::destroyed());
+    EXPECT_EQ(TrackedObject::created(), TrackedObject::destroyed());
 }
 
 TEST(ListMemoryTest, NoMemoryLeaksAfterDestroy) {
@@ -159,6 +164,148 @@ TEST(ListMemoryTest, NoMemoryLeaksAfterDestroy) {
     EXPECT_EQ(TrackedObject::created(), TrackedObject::destroyed());
 }
 
+TEST(ListTest, UsableAfterClear) {
+    List<int> list;
+    list.push_back(1);
+    list.clear();
+    list.push_back(2);
+
+    EXPECT_EQ(list.size(), 1);
+    EXPECT_EQ(list.front(), 2);
+}
+
+TEST(ListMemoryTest, UnusedCapacityIsNotConstructed) {
+    TrackedObject::reset_counters();
+
+    List<TrackedObject> list;
+    EXPECT_EQ(TrackedObject::created(), 0);
+
+    list.emplace_back();
+    EXPECT_EQ(TrackedObject::created(), 1);
+}
+
+TEST(ListMemoryTest, GrowthMovesInsteadOfCopying) {
+    TrackedObject::reset_counters();
+
+    List<TrackedObject> list;
+    for (int i = 0; i < 100; ++i)
+        list.emplace_back();
+
+    EXPECT_EQ(TrackedObject::copied(), 0);
+    EXPECT_GT(TrackedObject::moved(), 0);
+}
+
+TEST(ListMemoryTest, PopBackDestroysElement) {
+    TrackedObject::reset_counters();
+
+    List<TrackedObject> list;
+    list.emplace_back();
+    list.emplace_back();
+    list.pop_back();
+
+    EXPECT_EQ(TrackedObject::destroyed(), 1);
+}
+
+TEST(ListMoveOnlyTest, PushBackAndGrow) {
+    List<std::unique_ptr<int>> list;
+    for (int i = 0; i < 100; ++i)
+        list.push_back(std::make_unique<int>(i));
+
+    EXPECT_EQ(list.size(), 100);
+    EXPECT_EQ(*list.front(), 0);
+    EXPECT_EQ(*list.back(), 99);
+}
+
+TEST(ListMoveOnlyTest, PushFrontAndPopFront) {
+    List<std::unique_ptr<int>> list;
+    for (int i = 0; i < 20; ++i)
+        list.push_front(std::make_unique<int>(i));
+
+    EXPECT_EQ(*list.front(), 19);
+    list.pop_front();
+    EXPECT_EQ(*list.front(), 18);
+    EXPECT_EQ(*list.back(), 0);
+}
+
+TEST(ListMoveOnlyTest, MoveConstructor) {
+    List<std::unique_ptr<int>> list;
+    list.emplace_back(new int(7));
+
+    List<std::unique_ptr<int>> moved(std::move(list));
+    EXPECT_EQ(*moved.at(0), 7);
+    EXPECT_TRUE(list.is_empty());
+}
+
+TEST(ListTest, EmplaceBackConstructsInPlace) {
+    List<std::string> list;
+    std::string &value = list.emplace_back(3, 'a');
+
+    EXPECT_EQ(value, "aaa");
+    EXPECT_EQ(list.back(), "aaa");
+}
+
+TEST(ListTest, PushBackOwnElementWhileGrowing) {
+    List<std::string> list;
+    for (int i = 0; i < 8; ++i)
+        list.push_back(std::to_string(i));
+
+    list.push_back(list[0]);
+
+    EXPECT_EQ(list.size(), 9);
+    EXPECT_EQ(list.back(), "0");
+}
+
+TEST(ListTest, PushBackAfterMove) {
+    List<int> list;
+    list.push_back(1);
+    List<int> other(std::move(list));
+
+    list.push_back(2);
+    EXPECT_EQ(list.size(), 1);
+    EXPECT_EQ(list.front(), 2);
+}
+
+struct Point {
+    int x;
+    double y;
+};
+
+TEST(ListTest, TriviallyCopyableShiftAndCopy) {
+    List<Point> list;
+    for (int i = 0; i < 20; ++i)
+        list.push_front({i, i * 0.5});
+    list.pop_front();
+
+    List<Point> copy(list);
+    List<Point> assigned;
+    assigned.push_back({-1, -1.0});
+    assigned = list;
+
+    EXPECT_EQ(copy.size(), 19);
+    EXPECT_EQ(copy.front().x, 18);
+    EXPECT_EQ(copy.back().x, 0);
+    EXPECT_EQ(assigned.size(), 19);
+    EXPECT_EQ(assigned.front().y, 9.0);
+}
+
+TEST(ListTest, CopyAssignmentShrinksAndGrows) {
+    List<std::string> small;
+    small.push_back("a");
+
+    List<std::string> large;
+    for (int i = 0; i < 5; ++i)
+        large.push_back(std::to_string(i));
+
+    List<std::string> target;
+    target = large;
+    EXPECT_EQ(target.size(), 5);
+    EXPECT_EQ(target.back(), "4");
+
+    target = small;
+    EXPECT_EQ(target.size(), 1);
+    EXPECT_EQ(target.front(), "a");
+}
+
 TEST(ListIteratorTest, IterateThroughElements) {
     List<int> list;
     list.push_back(10);
@@ -185,3 +332,215 @@ TEST(ListIteratorTest, ConstIterateThroughElements) {
         expected += 10;
     }
 }
+
+TEST(ListAllocatorTest, AllocatesFromArena) {
+    MonotonicArena arena;
+    List<std::string, std::pmr::polymorphic_allocator<std::string>> list(&arena);
+    for (int i = 0; i < 100; ++i)
+        list.push_back(std::to_string(i));
+
+    EXPECT_GT(arena.allocated(), 100 * sizeof(std::string));
+    EXPECT_EQ(list.back(), "99");
+    EXPECT_EQ(list.get_allocator().resource(), &arena);
+}
+
+TEST(ListAllocatorTest, MoveAssignAcrossResources) {
+    MonotonicArena first_arena, second_arena;
+    List<std::string, std::pmr::polymorphic_allocator<std::string>> source(&first_arena);
+    List<std::string, std::pmr::polymorphic_allocator<std::string>> target(&second_arena);
+    for (int i = 0; i < 10; ++i)
+        source.push_back(std::to_string(i));
+
+    target = std::move(source);
+
+    EXPECT_EQ(target.size(), 10);
+    EXPECT_EQ(target.back(), "9");
+    EXPECT_EQ(target.get_allocator().resource(), &second_arena);
+    EXPECT_TRUE(source.is_empty());
+}
+
+TEST(ListAllocatorTest, CopyKeepsDefaultResource) {
+    MonotonicArena arena;
+    List<int, std::pmr::polymorphic_allocator<int>> list(&arena);
+    list.push_back(1);
+
+    List<int, std::pmr::polymorphic_allocator<int>> copy(list);
+
+    EXPECT_EQ(copy.front(), 1);
+    EXPECT_EQ(copy.get_allocator().resource(), std::pmr::get_default_resource());
+}
+
+TEST(ListBulkTest, ReserveAndShrinkToFit) {
+    List<int> list;
+    list.reserve(100);
+    EXPECT_EQ(list.capacity(), 100);
+
+    for (int i = 0; i < 100; ++i)
+        list.push_back(i);
+    EXPECT_EQ(list.capacity(), 100);
+
+    list.resize(10);
+    list.shrink_to_fit();
+    EXPECT_EQ(list.capacity(), 10);
+    EXPECT_EQ(list.back(), 9);
+}
+
+TEST(ListBulkTest, ResizeGrowsAndShrinks) {
+    List<std::string> list;
+    list.resize(3);
+    EXPECT_EQ(list.size(), 3);
+    EXPECT_EQ(list[2], "");
+
+    list.resize(20, "x");
+    EXPECT_EQ(list.size(), 20);
+    EXPECT_EQ(list.back(), "x");
+
+    list.resize(25, list[19]);
+    EXPECT_EQ(list.back(), "x");
+
+    list.resize(1);
+    EXPECT_EQ(list.size(), 1);
+}
+
+TEST(ListBulkTest, AppendRangeReservesOnce) {
+    const std::vector<int> source(100, 7);
+    List<int> list;
+    list.append(source.begin(), source.end());
+
+    EXPECT_EQ(list.size(), 100);
+    EXPECT_EQ(list.capacity(), 100);
+    EXPECT_EQ(list.back(), 7);
+}
+
+TEST(ListBulkTest, AppendUninitializedWritesInPlace) {
+    List<int> list;
+    list.push_back(1);
+    list.append_uninitialized(3, [](int *storage, size_t count) { std::fill_n(storage, count, 9); });
+    EXPECT_THROW(list.append_uninitialized(2, [](int *, size_t) { throw std::runtime_error("fill"); }),
+                 std::runtime_error);
+
+    ASSERT_EQ(list.size(), 4);
+    EXPECT_EQ(list.front(), 1);
+    EXPECT_EQ(list.back(), 9);
+}
+
+TEST(ListBulkTest, InsertRangeInTheMiddle) {
+    const int source[] = {10, 11, 12};
+    List<int> list;
+    for (int i = 0; i < 5; ++i)
+        list.push_back(i);
+
+    list.insert(2, std::begin(source), std::end(source));
+
+    const int expected[] = {0, 1, 10, 11, 12, 2, 3, 4};
+    ASSERT_EQ(list.size(), 8);
+    for (size_t i = 0; i < list.size(); ++i)
+        EXPECT_EQ(list[i], expected[i]);
+    EXPECT_THROW(list.insert(9, std::begin(source), std::end(source)), std::out_of_range);
+}
+
+TEST(ListBulkTest, EraseRange) {
+    List<std::string> list;
+    for (int i = 0; i < 6; ++i)
+        list.push_back(std::to_string(i));
+
+    list.erase(1, 4);
+    list.erase(0);
+
+    ASSERT_EQ(list.size(), 2);
+    EXPECT_EQ(list[0], "4");
+    EXPECT_EQ(list[1], "5");
+    EXPECT_THROW(list.erase(1, 3), std::out_of_range);
+}
+
+TEST(ListBulkTest, EraseShrinksSparseBuffer) {
+    List<int> list;
+    for (int i = 0; i < 128; ++i)
+        list.push_back(i);
+
+    list.erase(2, 128);
+    EXPECT_EQ(list.capacity(), 8);
+}
+
+TEST(ListGrowthPolicyTest, NeverShrinkKeepsCapacity) {
+    List<int, std::allocator<int>, NeverShrink<>> list;
+    for (int i = 0; i < 64; ++i)
+        list.push_back(i);
+    while (!list.is_empty())
+        list.pop_back();
+
+    EXPECT_EQ(list.capacity(), 64);
+}
+
+TEST(ListGrowthPolicyTest, CustomGrowthFactor) {
+    List<int, std::allocator<int>, GeometricGrowth<3, 2, 4, 4>> list;
+    for (int i = 0; i < 5; ++i)
+        list.push_back(i);
+
+    EXPECT_EQ(list.capacity(), 6);
+}
+
+TEST(ListGrowthPolicyTest, OscillationDoesNotReallocate) {
+    List<int> list;
+    for (int i = 0; i < 16; ++i)
+        list.push_back(i);
+    const int *data = &list[0];
+
+    for (int i = 0; i < 10; ++i) {
+        list.pop_back();
+        list.push_back(i);
+    }
+
+    EXPECT_EQ(&list[0], data);
+}
+
+static_assert(std::is_same_v<std::iterator_traits<List<int>::Iterator>::iterator_category,
+                             std::random_access_iterator_tag>);
+
+TEST(ListIteratorTest, SortAndBinarySearchInPlace) {
+    List<int> list;
+    for (int value: {5, 3, 9, 1, 7})
+        list.push_back(value);
+
+    std::sort(list.begin(), list.end());
+
+    for (size_t i = 1; i < list.size(); ++i)
+        EXPECT_LT(list[i - 1], list[i]);
+    EXPECT_EQ(*std::lower_bound(list.begin(), list.end(), 6), 7);
+}
+
+TEST(ListIteratorTest, ArithmeticAndOrdering) {
+    List<int> list;
+    for (int i = 0; i < 10; ++i)
+        list.push_back(i);
+
+    List<int>::Iterator it = list.begin() + 4;
+    EXPECT_EQ(*it, 4);
+    EXPECT_EQ(it[2], 6);
+    EXPECT_EQ(*(2 + it), 6);
+    EXPECT_EQ(list.end() - it, 6);
+    EXPECT_TRUE(list.begin() < it);
+    EXPECT_EQ(*it--, 4);
+    EXPECT_EQ(*it, 3);
+}
+
+TEST(ListIteratorTest, MutableConvertsToConst) {
+    List<int> list;
+    list.push_back(1);
+
+    List<int>::ConstIterator it = list.begin();
+    EXPECT_TRUE(it == list.begin());
+    EXPECT_EQ(list.end() - it, 1);
+    EXPECT_FALSE((std::is_convertible_v<List<int>::ConstIterator, List<int>::Iterator>));
+}
+
+TEST(ListTest, StatsAreDisabledByDefault) {
+    List<int> list;
+    for (int i = 0; i < 100; ++i)
+        list.push_back(i);
+
+    EXPECT_FALSE(detail::stats_enabled);
+    EXPECT_TRUE(std::is_empty_v<detail::StatsRecorder<>>);
+    EXPECT_EQ(list.stats().allocations, 0);
+    EXPECT_EQ(list.stats().peak_bytes, 0);
+}
@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+#include "../DataStructure/LockFreeStack.h"
+#include "TrackedObject.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(LockFreeStackTest, PopsInReverseOrder) {
+    LockFreeStack<std::string> stack;
+    EXPECT_TRUE(stack.is_empty());
+
+    stack.push_front("first");
+    stack.emplace_front(3, 'x');
+    stack.push_front("last");
+
+    std::string value;
+    for (const char *expected: {"last", "xxx", "first"}) {
+        ASSERT_TRUE(stack.try_pop_front(value));
+        EXPECT_EQ(value, expected);
+    }
+    EXPECT_FALSE(stack.try_pop_front(value));
+    EXPECT_TRUE(stack.is_empty());
+}
+
+TEST(LockFreeStackTest, FreesPoppedAndRemainingNodes) {
+    TrackedObject::reset_counters();
+    {
+        LockFreeStack<TrackedObject> stack;
+        for (int i = 0; i < 100; ++i)
+            stack.emplace_front();
+
+        TrackedObject popped;
+        for (int i = 0; i < 60; ++i)
+            ASSERT_TRUE(stack.try_pop_front(popped));
+    }
+    EXPECT_EQ(TrackedObject::created(), TrackedObject::destroyed());
+}
+
+TEST(LockFreeStackTest, ConcurrentPushesAndPops) {
+    constexpr int threads_count = 8;
+    constexpr int per_thread = 20000;
+
+    LockFreeStack<int> stack;
+    std::vector<std::atomic<int>> seen(threads_count * per_thread);
+    std::atomic<int> popped{0};
+
+    // Each thread pushes its own values and pops whatever it finds, so nodes keep being unlinked, freed and allocated
+    // again at the same addresses while other threads hold them.
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threads_count; ++thread) {
+        threads.emplace_back([&, thread] {
+            int value = 0;
+            for (int i = 0; i < per_thread; ++i) {
+                stack.push_front(thread * per_thread + i);
+                if (stack.try_pop_front(value)) {
+                    ++seen[value];
+                    ++popped;
+                }
+            }
+        });
+    }
+    for (std::thread &thread: threads)
+        thread.join();
+
+    int value = 0;
+    while (stack.try_pop_front(value)) {
+        ++seen[value];
+        ++popped;
+    }
+
+    EXPECT_EQ(popped.load(), threads_count * per_thread);
+    for (const std::atomic<int> &count: seen)
+        EXPECT_EQ(count.load(), 1);
+}
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+
+#include "../DataStructure/MemoryResource.h"
+
+TEST(MonotonicArenaTest, AllocationsAreAlignedAndDistinct) {
+    MonotonicArena arena(64);
+
+    void *first = arena.allocate(3, 1);
+    void *second = arena.allocate(sizeof(double), alignof(double));
+    void *third = arena.allocate(1000, 64);
+
+    EXPECT_NE(first, second);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(second) % alignof(double), 0);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(third) % 64, 0);
+    EXPECT_EQ(arena.allocated(), 3 + sizeof(double) + 1000);
+}
+
+TEST(MonotonicArenaTest, ReleaseFreesEverything) {
+    MonotonicArena arena;
+    for (int i = 0; i < 100; ++i)
+        static_cast<void>(arena.allocate(128, 8));
+
+    arena.release();
+    EXPECT_EQ(arena.allocated(), 0);
+
+    void *pointer = arena.allocate(16, 8);
+    EXPECT_NE(pointer, nullptr);
+}
+
+TEST(PoolResourceTest, ReusesFreedBlocks) {
+    PoolResource pool(24, 4);
+
+    void *first = pool.allocate(24, 8);
+    pool.deallocate(first, 24, 8);
+    void *second = pool.allocate(16, 8);
+
+    EXPECT_EQ(first, second);
+}
+
+TEST(PoolResourceTest, GrowsBeyondOneChunk) {
+    PoolResource pool(16, 2);
+
+    void *blocks[10];
+    for (void *&block: blocks)
+        block = pool.allocate(16, 8);
+
+    for (int i = 0; i < 10; ++i)
+        for (int j = i + 1; j < 10; ++j)
+            EXPECT_NE(blocks[i], blocks[j]);
+}
+
+TEST(PoolResourceTest, LargeRequestsGoUpstream) {
+    PoolResource pool(16);
+
+    void *pointer = pool.allocate(1024, 8);
+    EXPECT_NE(pointer, nullptr);
+    pool.deallocate(pointer, 1024, 8);
+}
@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+#include "../DataStructure/MpscQueue.h"
+#include "TrackedObject.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+TEST(MpscQueueTest, PopsInPushOrder) {
+    MpscQueue<std::string> queue;
+    EXPECT_TRUE(queue.is_empty());
+
+    queue.push_back("first");
+    queue.emplace_back(3, 'x');
+    queue.push_back("last");
+    EXPECT_FALSE(queue.is_empty());
+
+    std::string value;
+    for (const char *expected: {"first", "xxx", "last"}) {
+        ASSERT_TRUE(queue.try_pop_front(value));
+        EXPECT_EQ(value, expected);
+    }
+    EXPECT_FALSE(queue.try_pop_front(value));
+    EXPECT_TRUE(queue.is_empty());
+}
+
+TEST(MpscQueueTest, DestroysRemainingElements) {
+    TrackedObject::reset_counters();
+    {
+        MpscQueue<TrackedObject> queue;
+        for (int i = 0; i < 10; ++i)
+            queue.emplace_back();
+
+        TrackedObject popped;
+        ASSERT_TRUE(queue.try_pop_front(popped));
+    }
+    EXPECT_EQ(TrackedObject::created(), TrackedObject::destroyed());
+}
+
+TEST(MpscQueueTest, ProducersKeepTheirOrder) {
+    constexpr int producers = 4;
+    constexpr int per_producer = 20000;
+
+    MpscQueue<std::pair<int, int>> queue;
+    std::vector<std::thread> threads;
+    for (int producer = 0; producer < producers; ++producer) {
+        threads.emplace_back([&, producer] {
+            for (int i = 0; i < per_producer; ++i)
+                queue.push_back({producer, i});
+        });
+    }
+
+    // Every producer's elements come out in the order it pushed them, interleaved with the others'.
+    std::vector<int> next(producers, 0);
+    int popped = 0;
+    std::pair<int, int> value;
+    while (popped < producers * per_producer) {
+        if (!queue.try_pop_front(value))
+            continue;
+        ASSERT_EQ(value.second, next[value.first]);
+        ++next[value.first];
+        ++popped;
+    }
+    for (std::thread &thread: threads)
+        thread.join();
+
+    EXPECT_FALSE(queue.try_pop_front(value));
+    for (int count: next)
+        EXPECT_EQ(count, per_producer);
+}
@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+#include "../DataStructure/MemoryResource.h"
+#include "../DataStructure/NodePool.h"
+
+#include <memory_resource>
+#include <set>
+
+namespace {
+    struct Node {
+        Node *next;
+        long value;
+    };
+}
+
+TEST(NodePoolTest, AllocatesConsecutiveNodes) {
+    NodePool<Node> pool;
+    Node *first = pool.allocate();
+    Node *second = pool.allocate();
+
+    EXPECT_EQ(second, first + 1);
+    pool.deallocate(second);
+    pool.deallocate(first);
+}
+
+TEST(NodePoolTest, RecyclesFreedNodes) {
+    NodePool<Node> pool;
+    Node *node = pool.allocate();
+    pool.deallocate(node);
+
+    EXPECT_EQ(pool.allocate(), node);
+}
+
+TEST(NodePoolTest, GrowsAcrossChunks) {
+    NodePool<Node> pool;
+    std::set<Node *> nodes;
+    for (size_t i = 0; i < 10 * NodePool<Node>::max_chunk_size; ++i)
+        nodes.insert(pool.allocate());
+
+    EXPECT_EQ(nodes.size(), 10 * NodePool<Node>::max_chunk_size);
+}
+
+TEST(NodePoolTest, SpliceTakesOverChunksAndFreeNodes) {
+    MonotonicArena arena;
+    NodePool<Node, std::pmr::polymorphic_allocator<Node>> first(&arena);
+    NodePool<Node, std::pmr::polymorphic_allocator<Node>> second(&arena);
+
+    Node *kept = second.allocate();
+    Node *freed = second.allocate();
+    second.deallocate(freed);
+
+    first.splice(second);
+    EXPECT_EQ(first.allocate(), freed);
+    first.deallocate(kept);
+    EXPECT_EQ(first.allocate(), kept);
+}
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+#include "../DataStructure/Heap.h"
+#include "../DataStructure/MemoryResource.h"
+#include "../DataStructure/PairingHeap.h"
+#include "TrackedObject.h"
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+TEST(PairingHeapTest, PopsInOrder) {
+    PairingHeap<int> heap;
+    for (int value: {5, 2, 9, 1, 7, 2})
+        heap.insert(value);
+
+    EXPECT_EQ(heap.size(), 6);
+    EXPECT_EQ(heap.peek(), 1);
+    for (int expected: {1, 2, 2, 5, 7, 9})
+        EXPECT_EQ(heap.pop(), expected);
+    EXPECT_TRUE(heap.isEmpty());
+    EXPECT_THROW(heap.pop(), std::out_of_range);
+    EXPECT_THROW(heap.peek(), std::out_of_range);
+}
+
+TEST(PairingHeapTest, MatchesHeap) {
+    PairingHeap<int, std::greater<>> pairing;
+    Heap<int, std::greater<>> heap;
+    std::mt19937 random(5);
+
+    for (int step = 0; step < 20000; ++step) {
+        if (heap.isEmpty() || random() % 3 != 0) {
+            const int value = static_cast<int>(random() % 10000);
+            pairing.push(value);
+            heap.push(value);
+        } else {
+            ASSERT_EQ(pairing.pop(), heap.pop());
+        }
+    }
+    while (!heap.isEmpty())
+        ASSERT_EQ(pairing.pop(), heap.pop());
+}
+
+TEST(PairingHeapTest, Merge) {
+    PairingHeap<int> first(std::less<int>{});
+    PairingHeap<int> second;
+    for (int i = 0; i < 100; i += 2)
+        first.push(i);
+    for (int i = 1; i < 100; i += 2)
+        second.push(i);
+
+    first.merge(second);
+    EXPECT_EQ(first.size(), 100);
+    EXPECT_TRUE(second.isEmpty());
+
+    first.merge(first);
+    EXPECT_EQ(first.size(), 100);
+
+    // second keeps working with a fresh pool.
+    second.push(-1);
+    EXPECT_EQ(second.pop(), -1);
+
+    for (int i = 0; i < 100; ++i)
+        EXPECT_EQ(first.pop(), i);
+}
+
+TEST(PairingHeapTest, MergeAcrossResources) {
+    MonotonicArena first_arena;
+    MonotonicArena second_arena;
+    using PmrHeap = PairingHeap<std::string, std::less<>, std::pmr::polymorphic_allocator<std::string>>;
+    PmrHeap first(std::less<>(), &first_arena);
+    PmrHeap second(std::less<>(), &second_arena);
+    first.push("b");
+    second.push("a");
+    second.push("c");
+
+    first.merge(second);
+    EXPECT_TRUE(second.isEmpty());
+    EXPECT_EQ(first.pop(), "a");
+    EXPECT_EQ(first.pop(), "b");
+    EXPECT_EQ(first.pop(), "c");
+}
+
+TEST(PairingHeapTest, RangeConstructionCopyAndMove) {
+    const std::vector<int> source = {4, 8, 1, 6, 3};
+    PairingHeap<int> heap(source.begin(), source.end());
+    heap.pop();
+
+    PairingHeap<int> copy(heap);
+    PairingHeap<int> moved(std::move(heap));
+    EXPECT_TRUE(heap.isEmpty());
+
+    copy = moved;
+    for (int expected: {3, 4, 6, 8}) {
+        EXPECT_EQ(copy.pop(), expected);
+        EXPECT_EQ(moved.pop(), expected);
+    }
+}
+
+TEST(PairingHeapTest, MoveOnlyElements) {
+    auto by_value = [](const std::unique_ptr<int> &a, const std::unique_ptr<int> &b) { return *a < *b; };
+    PairingHeap<std::unique_ptr<int>, decltype(by_value)> heap(by_value);
+    heap.push(std::make_unique<int>(2));
+    heap.emplace(new int(1));
+
+    EXPECT_EQ(*heap.pop(), 1);
+    EXPECT_EQ(*heap.pop(), 2);
+}
+
+TEST(PairingHeapMemoryTest, DeepTreesAreDestroyedWithoutLeaks) {
+    TrackedObject::reset_counters();
+    {
+        auto by_address = [](const TrackedObject &a, const TrackedObject &b) { return &a < &b; };
+        PairingHeap<TrackedObject, decltype(by_address)> heap(by_address);
+        for (int i = 0; i < 100000; ++i)
+            heap.emplace();
+        heap.pop();
+
+        PairingHeap<TrackedObject, decltype(by_address)> copy(heap);
+        EXPECT_EQ(copy.size(), heap.size());
+    }
+    EXPECT_EQ(TrackedObject::created(), TrackedObject::destroyed());
+}
@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include "../DataStructure/Heap.h"
+#include "../DataStructure/MemoryResource.h"
+#include "../DataStructure/RadixHeap.h"
+
+#include <cstdint>
+#include <random>
+
+TEST(RadixHeapTest, PopsInOrder) {
+    RadixHeap<> heap;
+    for (uint64_t key: {50, 3, 17, 3, 1000000, 0})
+        heap.insert(key);
+
+    EXPECT_EQ(heap.size(), 6);
+    EXPECT_EQ(heap.peek(), 0);
+    for (uint64_t expected: {0, 3, 3, 17, 50, 1000000})
+        EXPECT_EQ(heap.pop(), expected);
+    EXPECT_TRUE(heap.isEmpty());
+    EXPECT_THROW(heap.pop(), std::out_of_range);
+    EXPECT_THROW(heap.peek(), std::out_of_range);
+}
+
+TEST(RadixHeapTest, RejectsKeysBelowTheLastPop) {
+    RadixHeap<uint32_t> heap;
+    heap.insert(10);
+    heap.insert(20);
+    EXPECT_EQ(heap.pop(), 10);
+
+    EXPECT_THROW(heap.insert(9), std::invalid_argument);
+    heap.insert(10);
+    heap.insert(15);
+    EXPECT_EQ(heap.peek(), 10);
+    EXPECT_EQ(heap.pop(), 10);
+    EXPECT_EQ(heap.pop(), 15);
+    EXPECT_EQ(heap.pop(), 20);
+}
+
+TEST(RadixHeapTest, PeekDoesNotRaiseTheFloor) {
+    RadixHeap<> heap;
+    heap.insert(0);
+    heap.pop();
+    heap.insert(100);
+
+    EXPECT_EQ(heap.peek(), 100);
+    heap.insert(5);
+    EXPECT_EQ(heap.pop(), 5);
+}
+
+TEST(RadixHeapTest, ExtremeKeys) {
+    RadixHeap<uint8_t> heap;
+    heap.insert(255);
+    heap.insert(0);
+    heap.insert(128);
+    EXPECT_EQ(heap.pop(), 0);
+    EXPECT_EQ(heap.pop(), 128);
+    EXPECT_EQ(heap.pop(), 255);
+}
+
+// bucket_of counts leading zeros with a compiler builtin, and falls back to the loop elsewhere.
+TEST(RadixHeapTest, BitWidthMatchesTheLoop) {
+    EXPECT_EQ(detail::bit_width(0), 0);
+    EXPECT_EQ(detail::bit_width_loop(0), 0);
+    for (size_t bit = 0; bit < 64; ++bit) {
+        const unsigned long long value = 1ull << bit;
+        EXPECT_EQ(detail::bit_width(value), bit + 1);
+        EXPECT_EQ(detail::bit_width_loop(value), bit + 1);
+        EXPECT_EQ(detail::bit_width(value | (value - 1)), detail::bit_width_loop(value | (value - 1)));
+    }
+}
+
+TEST(RadixHeapTest, MatchesHeapOnAMonotoneWorkload) {
+    RadixHeap<> radix;
+    Heap<uint64_t> heap;
+    std::mt19937_64 random(3);
+    for (int i = 0; i < 100; ++i) {
+        const uint64_t key = random() % 1000;
+        radix.insert(key);
+        heap.push(key);
+    }
+
+    while (!heap.isEmpty()) {
+        const uint64_t popped = heap.pop();
+        ASSERT_EQ(radix.pop(), popped);
+        if (random() % 2 == 0 && popped < 1000000) {
+            const uint64_t key = popped + random() % 5000;
+            radix.insert(key);
+            heap.push(key);
+        }
+    }
+    EXPECT_TRUE(radix.isEmpty());
+}
+
+TEST(RadixHeapAllocatorTest, BucketsAllocateFromTheResource) {
+    MonotonicArena arena;
+    RadixHeap<uint64_t, std::pmr::polymorphic_allocator<uint64_t>> heap(&arena);
+    heap.insert(1);
+    heap.insert(7);
+
+    EXPECT_GT(arena.allocated(), 0);
+    EXPECT_EQ(heap.pop(), 1);
+}
@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <string>
+
+#include "../DataStructure/Array.h"
+#include "../DataStructure/List.h"
+#include "../DataStructure/Simd.h"
+
+// Sizes around the vector widths, so that both the vector loop and the scalar tail are exercised.
+TEST(SimdTest, MatchesScalarForInts) {
+    for (int size = 0; size < 40; ++size) {
+        List<int> list;
+        for (int i = 0; i < size; ++i)
+            list.push_back((i * 7919) % 23 - 11);
+
+        EXPECT_EQ(simd::find(list, 5), detail::simd::find_scalar(list.data(), list.size(), 5));
+        EXPECT_EQ(simd::count(list, 5), detail::simd::count_scalar(list.data(), list.size(), 5));
+
+        if (size == 0)
+            continue;
+        EXPECT_EQ(list[simd::min_element(list)], *std::min_element(list.begin(), list.end()));
+        EXPECT_EQ(list[simd::max_element(list)], *std::max_element(list.begin(), list.end()));
+        EXPECT_EQ(simd::sum(list), std::accumulate(list.begin(), list.end(), 0));
+    }
+}
+
+TEST(SimdTest, MatchesScalarForFloats) {
+    for (int size = 1; size < 40; ++size) {
+        List<float> list;
+        for (int i = 0; i < size; ++i)
+            list.push_back(static_cast<float>((i * 31) % 17) - 8.5f);
+
+        EXPECT_EQ(simd::find(list, 0.5f), detail::simd::find_scalar(list.data(), list.size(), 0.5f));
+        EXPECT_EQ(simd::count(list, 0.5f), detail::simd::count_scalar(list.data(), list.size(), 0.5f));
+        EXPECT_EQ(simd::min_element(list), std::min_element(list.begin(), list.end()) - list.begin());
+        EXPECT_EQ(simd::max_element(list), std::max_element(list.begin(), list.end()) - list.begin());
+        EXPECT_FLOAT_EQ(simd::sum(list), std::accumulate(list.begin(), list.end(), 0.0f));
+    }
+}
+
+namespace {
+    // Values straddling zero and the sign bit of the lanes, where a signed and an unsigned comparison disagree.
+    template<typename Type>
+    List<Type> make_mixed_list(int size) {
+        List<Type> list;
+        for (int i = 0; i < size; ++i) {
+            if (i % 5 == 3)
+                list.push_back(i % 2 == 0 ? std::numeric_limits<Type>::max() : std::numeric_limits<Type>::lowest());
+            else
+                list.push_back(static_cast<Type>((i * 7919) % 23 - 11));
+        }
+        return list;
+    }
+
+    template<typename Type>
+    void expect_matches_scalar() {
+        for (int size = 1; size < 40; ++size) {
+            const List<Type> list = make_mixed_list<Type>(size);
+            const Type needle = static_cast<Type>(5);
+
+            EXPECT_EQ(simd::find(list, needle), detail::simd::find_scalar(list.data(), list.size(), needle));
+            EXPECT_EQ(simd::count(list, needle), detail::simd::count_scalar(list.data(), list.size(), needle));
+            EXPECT_EQ(simd::min_element(list), std::min_element(list.begin(), list.end()) - list.begin());
+            EXPECT_EQ(simd::max_element(list), std::max_element(list.begin(), list.end()) - list.begin());
+            EXPECT_EQ(simd::sum(list), (detail::simd::reduce_scalar<detail::simd::Reduction::sum>(list.data(),
+                                                                                                  list.size())));
+        }
+    }
+} // namespace
+
+TEST(SimdTest, MatchesScalarForOtherLanes) {
+    expect_matches_scalar<unsigned>();
+    expect_matches_scalar<int64_t>();
+    expect_matches_scalar<uint64_t>();
+    expect_matches_scalar<long long>();
+}
+
+TEST(SimdTest, MatchesScalarForDoubles) {
+    for (int size = 1; size < 40; ++size) {
+        List<double> list;
+        for (int i = 0; i < size; ++i)
+            list.push_back(static_cast<double>((i * 31) % 17) - 8.5);
+
+        EXPECT_EQ(simd::find(list, 0.5), detail::simd::find_scalar(list.data(), list.size(), 0.5));
+        EXPECT_EQ(simd::count(list, 0.5), detail::simd::count_scalar(list.data(), list.size(), 0.5));
+        EXPECT_EQ(simd::min_element(list), std::min_element(list.begin(), list.end()) - list.begin());
+        EXPECT_EQ(simd::max_element(list), std::max_element(list.begin(), list.end()) - list.begin());
+        EXPECT_DOUBLE_EQ(simd::sum(list), std::accumulate(list.begin(), list.end(), 0.0));
+    }
+}
+
+TEST(SimdTest, FindReturnsFirstMatch) {
+    Array<int, 20> array{0};
+    array[13] = 4;
+    array[17] = 4;
+
+    EXPECT_EQ(simd::find(array, 4), 13);
+    EXPECT_TRUE(simd::contains(array, 4));
+    EXPECT_FALSE(simd::contains(array, 5));
+    EXPECT_EQ(simd::find(array, 5), array.size());
+}
+
+TEST(SimdTest, EmptyContainer) {
+    const List<int> list;
+
+    EXPECT_EQ(simd::find(list, 1), 0);
+    EXPECT_EQ(simd::count(list, 1), 0);
+    EXPECT_EQ(simd::min_element(list), 0);
+    EXPECT_EQ(simd::sum(list), 0);
+}
+
+TEST(SimdTest, OtherTypesFallBackToScalar) {
+    List<std::string> strings;
+    strings.push_back("a");
+    strings.push_back("b");
+    List<bool> flags;
+    flags.push_back(false);
+    flags.push_back(true);
+
+    EXPECT_EQ(simd::find(strings, "b"), 1);
+    EXPECT_EQ(simd::find(flags, true), 1);
+    EXPECT_EQ(simd::max_element(flags), 1);
+    EXPECT_TRUE(simd::sum(flags));
+}
+
+#ifdef SIMD_X86_64
+TEST(SimdTest, Sse2KernelsMatchAvx2) {
+    List<int> list;
+    for (int i = 0; i < 37; ++i)
+        list.push_back((i * 13) % 29 - 14);
+
+    using namespace detail::simd;
+    EXPECT_EQ((find_sse2<Sse2<int>>(list.data(), list.size(), 3)), find_scalar(list.data(), list.size(), 3));
+    EXPECT_EQ((count_sse2<Sse2<int>>(list.data(), list.size(), 3)), count_scalar(list.data(), list.size(), 3));
+    EXPECT_EQ((reduce_sse2<Reduction::min, Sse2<int>>(list.data(), list.size())), -14);
+    EXPECT_EQ((reduce_sse2<Reduction::max, Sse2<int>>(list.data(), list.size())), 14);
+
+    if (has_avx2()) {
+        EXPECT_EQ((find_avx2<Avx2<int>>(list.data(), list.size(), 3)), find_scalar(list.data(), list.size(), 3));
+        EXPECT_EQ((reduce_avx2<Reduction::sum, Avx2<int>>(list.data(), list.size())),
+                  (reduce_sse2<Reduction::sum, Sse2<int>>(list.data(), list.size())));
+    }
+}
+
+TEST(SimdTest, Sse2KernelsMatchAvx2ForOtherLanes) {
+    const List<uint64_t> list = make_mixed_list<uint64_t>(37);
+    const List<int64_t> signed_list = make_mixed_list<int64_t>(37);
+    const List<unsigned> narrow_list = make_mixed_list<unsigned>(37);
+
+    using namespace detail::simd;
+    EXPECT_EQ((find_sse2<Sse2<uint64_t>>(list.data(), list.size(), uint64_t{5})),
+              find_scalar(list.data(), list.size(), uint64_t{5}));
+    EXPECT_EQ((reduce_sse2<Reduction::min, Sse2<uint64_t>>(list.data(), list.size())), 0);
+    EXPECT_EQ((reduce_sse2<Reduction::max, Sse2<uint64_t>>(list.data(), list.size())),
+              std::numeric_limits<uint64_t>::max());
+    EXPECT_EQ((reduce_sse2<Reduction::min, Sse2<int64_t>>(signed_list.data(), signed_list.size())),
+              std::numeric_limits<int64_t>::lowest());
+    EXPECT_EQ((reduce_sse2<Reduction::max, Sse2<unsigned>>(narrow_list.data(), narrow_list.size())),
+              std::numeric_limits<unsigned>::max());
+
+    if (has_avx2()) {
+        EXPECT_EQ((reduce_avx2<Reduction::min, Avx2<uint64_t>>(list.data(), list.size())), 0);
+        EXPECT_EQ((reduce_avx2<Reduction::min, Avx2<int64_t>>(signed_list.data(), signed_list.size())),
+                  std::numeric_limits<int64_t>::lowest());
+        EXPECT_EQ((reduce_avx2<Reduction::max, Avx2<unsigned>>(narrow_list.data(), narrow_list.size())),
+                  std::numeric_limits<unsigned>::max());
+        EXPECT_EQ((reduce_avx2<Reduction::sum, Avx2<int64_t>>(signed_list.data(), signed_list.size())),
+                  (reduce_sse2<Reduction::sum, Sse2<int64_t>>(signed_list.data(), signed_list.size())));
+    }
+}
+#endif
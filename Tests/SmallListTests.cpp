@@ -0,0 +1,194 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "../DataStructure/SmallList.h"
+#include "TrackedObject.h"
+
+TEST(SmallListTest, EmptyOnConstruction) {
+    const SmallList<int, 4> list;
+
+    EXPECT_TRUE(list.is_empty());
+    EXPECT_TRUE(list.is_inline());
+    EXPECT_EQ(list.size(), 0);
+}
+
+TEST(SmallListTest, StaysInlineUpToCapacity) {
+    SmallList<int, 4> list;
+    for (int i = 0; i < 4; ++i)
+        list.push_back(i);
+
+    EXPECT_TRUE(list.is_inline());
+    EXPECT_EQ(list.front(), 0);
+    EXPECT_EQ(list.back(), 3);
+}
+
+TEST(SmallListTest, SpillsToHeapWhenFull) {
+    SmallList<int, 4> list;
+    for (int i = 0; i < 100; ++i)
+        list.push_back(i);
+
+    EXPECT_FALSE(list.is_inline());
+    EXPECT_EQ(list.size(), 100);
+    for (size_t i = 0; i < list.size(); ++i)
+        EXPECT_EQ(list[i], static_cast<int>(i));
+}
+
+TEST(SmallListTest, ClearReturnsToInlineStorage) {
+    SmallList<int, 2> list;
+    for (int i = 0; i < 10; ++i)
+        list.push_back(i);
+
+    list.clear();
+
+    EXPECT_TRUE(list.is_empty());
+    EXPECT_TRUE(list.is_inline());
+}
+
+TEST(SmallListTest, PushAndPopFront) {
+    SmallList<std::string, 2> list;
+    list.push_front("c");
+    list.push_front("b");
+    list.push_front("a");
+
+    EXPECT_EQ(list.front(), "a");
+    EXPECT_EQ(list.back(), "c");
+
+    list.pop_front();
+    EXPECT_EQ(list.front(), "b");
+    EXPECT_EQ(list.size(), 2);
+}
+
+TEST(SmallListTest, AccessThrowsWhenOutOfRange) {
+    SmallList<int, 4> list;
+
+    EXPECT_THROW(list.front(), std::out_of_range);
+    EXPECT_THROW(list.back(), std::out_of_range);
+    EXPECT_THROW(list.at(0), std::out_of_range);
+}
+
+TEST(SmallListTest, CopyInlineAndSpilled) {
+    SmallList<std::string, 3> inline_list;
+    inline_list.push_back("a");
+    SmallList<std::string, 3> spilled_list;
+    for (int i = 0; i < 10; ++i)
+        spilled_list.push_back(std::to_string(i));
+
+    SmallList<std::string, 3> inline_copy(inline_list);
+    SmallList<std::string, 3> spilled_copy(spilled_list);
+
+    EXPECT_TRUE(inline_copy.is_inline());
+    EXPECT_EQ(inline_copy.front(), "a");
+    EXPECT_FALSE(spilled_copy.is_inline());
+    EXPECT_EQ(spilled_copy.back(), "9");
+
+    spilled_copy = inline_list;
+    EXPECT_EQ(spilled_copy.size(), 1);
+    EXPECT_EQ(spilled_copy.front(), "a");
+}
+
+TEST(SmallListTest, MoveInlineAndSpilled) {
+    SmallList<std::unique_ptr<int>, 2> inline_list;
+    inline_list.push_back(std::make_unique<int>(1));
+    SmallList<std::unique_ptr<int>, 2> spilled_list;
+    for (int i = 0; i < 5; ++i)
+        spilled_list.push_back(std::make_unique<int>(i));
+
+    SmallList<std::unique_ptr<int>, 2> moved_inline(std::move(inline_list));
+    SmallList<std::unique_ptr<int>, 2> moved_spilled(std::move(spilled_list));
+
+    EXPECT_EQ(*moved_inline.front(), 1);
+    EXPECT_EQ(*moved_spilled.back(), 4);
+    EXPECT_TRUE(inline_list.is_empty());
+    EXPECT_TRUE(spilled_list.is_empty());
+
+    moved_inline = std::move(moved_spilled);
+    EXPECT_EQ(moved_inline.size(), 5);
+}
+
+namespace {
+    // Copies throw once copies_left runs out, and moves may throw, so relocating copies the elements.
+    struct ThrowingCopy {
+        explicit ThrowingCopy(std::string value) : value(std::move(value)) {}
+        ThrowingCopy(const ThrowingCopy &other) : value(other.value) {
+            if (copies_left == 0)
+                throw std::runtime_error("copy failed");
+            --copies_left;
+        }
+        ThrowingCopy(ThrowingCopy &&other) noexcept(false) = default;
+
+        std::string value;
+        inline static size_t copies_left = SIZE_MAX;
+    };
+} // namespace
+
+// The inline source is relocated into the spilled destination, whose elements are already gone when the copy throws.
+TEST(SmallListTest, ThrowingMoveAssignmentLeavesAnEmptyList) {
+    SmallList<ThrowingCopy, 2> list;
+    for (int i = 0; i < 4; ++i)
+        list.emplace_back("a long enough string to allocate, spilled " + std::to_string(i));
+    SmallList<ThrowingCopy, 2> source;
+    source.emplace_back("a long enough string to allocate, inline 0");
+    source.emplace_back("a long enough string to allocate, inline 1");
+
+    ThrowingCopy::copies_left = 1;
+    EXPECT_THROW(list = std::move(source), std::runtime_error);
+    ThrowingCopy::copies_left = SIZE_MAX;
+
+    EXPECT_TRUE(list.is_empty());
+    EXPECT_EQ(source.size(), 2);
+    list.emplace_back("usable again");
+    EXPECT_EQ(list.front().value, "usable again");
+}
+
+TEST(SmallListTest, ThrowingCopyAssignment) {
+    SmallList<ThrowingCopy, 2> list;
+    list.emplace_back("a long enough string to allocate, kept");
+    SmallList<ThrowingCopy, 2> source;
+    source.emplace_back("a long enough string to allocate, inline 0");
+    source.emplace_back("a long enough string to allocate, inline 1");
+
+    ThrowingCopy::copies_left = 1;
+    EXPECT_THROW(list = source, std::runtime_error);
+    ThrowingCopy::copies_left = SIZE_MAX;
+
+    ASSERT_EQ(list.size(), 1);
+    EXPECT_EQ(list.front().value, "a long enough string to allocate, kept");
+
+    // The copy succeeds, then relocating it into the list throws, once the list's own elements are gone.
+    ThrowingCopy::copies_left = 3;
+    EXPECT_THROW(list = source, std::runtime_error);
+    ThrowingCopy::copies_left = SIZE_MAX;
+
+    EXPECT_TRUE(list.is_empty());
+}
+
+TEST(SmallListMemoryTest, NoMemoryLeaks) {
+    TrackedObject::reset_counters();
+
+    {
+        SmallList<TrackedObject, 4> list;
+        for (int i = 0; i < 50; ++i)
+            list.emplace_back();
+        SmallList<TrackedObject, 4> copy(list);
+        copy.clear();
+        copy.emplace_back();
+    }
+
+    EXPECT_EQ(TrackedObject::created(), TrackedObject::destroyed());
+}
+
+TEST(SmallListIteratorTest, IterateThroughElements) {
+    SmallList<int, 4> list;
+    list.push_back(10);
+    list.push_back(20);
+    list.push_back(30);
+
+    int expected = 10;
+    for (int value: list) {
+        EXPECT_EQ(value, expected);
+        expected += 10;
+    }
+}
@@ -0,0 +1,267 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <system_error>
+
+#include "../DataStructure/MappedList.h"
+#include "../DataStructure/Snapshot.h"
+
+namespace {
+    struct Record {
+        uint64_t id;
+        double score;
+        int32_t flags;
+    };
+
+    // A snapshot file removed at the end of the test.
+    struct TemporaryFile {
+        TemporaryFile() :
+            path((std::filesystem::temp_directory_path() /
+                  ("snapshot_test_" + std::to_string(reinterpret_cast<std::uintptr_t>(this)) + ".bin"))
+                     .string()) {}
+        ~TemporaryFile() { std::remove(path.c_str()); }
+
+        std::string path;
+    };
+
+    List<int> make_list(int count) {
+        List<int> list;
+        for (int i = 0; i < count; ++i)
+            list.push_back(i * 7 - 3);
+        return list;
+    }
+} // namespace
+
+TEST(SnapshotTest, ListRoundTrip) {
+    const List<int> list = make_list(1000);
+    std::stringstream stream;
+    save_snapshot(stream, list);
+
+    const List<int> loaded = load_list<int>(stream);
+
+    ASSERT_EQ(loaded.size(), list.size());
+    EXPECT_TRUE(std::equal(list.begin(), list.end(), loaded.begin()));
+}
+
+TEST(SnapshotTest, EmptyListRoundTrip) {
+    std::stringstream stream;
+    save_snapshot(stream, List<int>());
+
+    EXPECT_TRUE(load_list<int>(stream).is_empty());
+}
+
+TEST(SnapshotTest, StructRoundTrip) {
+    List<Record> list;
+    for (uint64_t i = 0; i < 100; ++i)
+        list.push_back(Record{i, i * 0.5, static_cast<int32_t>(i % 3)});
+    std::stringstream stream;
+    save_snapshot(stream, list);
+
+    const List<Record> loaded = load_list<Record>(stream);
+
+    ASSERT_EQ(loaded.size(), 100);
+    EXPECT_EQ(loaded[42].id, 42);
+    EXPECT_DOUBLE_EQ(loaded[42].score, 21.0);
+    EXPECT_EQ(loaded[42].flags, 0);
+}
+
+TEST(SnapshotTest, ArrayRoundTrip) {
+    const Array<int, 5> array{1, 2, 3, 4, 5};
+    std::stringstream stream;
+    save_snapshot(stream, array);
+
+    EXPECT_EQ((load_array<int, 5>(stream)), array);
+}
+
+TEST(SnapshotTest, ArrayOfAnotherSizeIsRejected) {
+    std::stringstream stream;
+    save_snapshot(stream, Array<int, 5>(1));
+
+    EXPECT_THROW((load_array<int, 4>(stream)), std::runtime_error);
+}
+
+TEST(SnapshotTest, HeapRoundTrip) {
+    Heap<int> heap;
+    for (int value: {5, 1, 9, 3, 7, 2})
+        heap.push(value);
+    std::stringstream stream;
+    save_snapshot(stream, heap);
+
+    Heap<int> loaded = load_heap<int>(stream);
+
+    ASSERT_EQ(loaded.size(), 6);
+    for (int expected: {1, 2, 3, 5, 7, 9})
+        EXPECT_EQ(loaded.pop(), expected);
+}
+
+TEST(SnapshotTest, LargeHeapIsReadInBatches) {
+    Heap<int, std::greater<>> heap;
+    for (int value = 0; value < 200000; ++value)
+        heap.push(value * 7919 % 200000);
+    std::stringstream stream;
+    save_snapshot(stream, heap);
+
+    Heap<int, std::greater<>> loaded = load_heap<int, std::greater<>>(stream);
+
+    ASSERT_EQ(loaded.size(), heap.size());
+    EXPECT_TRUE(std::equal(heap.data(), heap.data() + heap.size(), loaded.data()));
+    EXPECT_EQ(loaded.pop(), 199999);
+}
+
+TEST(SnapshotTest, SnapshotsFollowEachOther) {
+    std::stringstream stream;
+    save_snapshot(stream, make_list(10));
+    save_snapshot(stream, Array<int, 3>{4, 5, 6});
+
+    EXPECT_EQ(load_list<int>(stream).size(), 10);
+    EXPECT_EQ((load_array<int, 3>(stream)), (Array<int, 3>{4, 5, 6}));
+}
+
+TEST(SnapshotTest, ElementTypeMismatchIsRejected) {
+    std::stringstream stream;
+    save_snapshot(stream, make_list(10));
+
+    EXPECT_THROW(load_list<int64_t>(stream), std::runtime_error);
+}
+
+TEST(SnapshotTest, KindMismatchIsRejected) {
+    std::stringstream stream;
+    save_snapshot(stream, make_list(10));
+
+    EXPECT_THROW(load_heap<int>(stream), std::runtime_error);
+}
+
+TEST(SnapshotTest, GarbageIsRejected) {
+    std::stringstream stream(std::string(100, 'x'));
+
+    EXPECT_THROW(load_list<int>(stream), std::runtime_error);
+}
+
+TEST(SnapshotTest, TruncatedSnapshotIsRejected) {
+    std::stringstream stream;
+    save_snapshot(stream, make_list(100));
+    std::string bytes = stream.str();
+    bytes.resize(bytes.size() - 1);
+    std::stringstream truncated(bytes);
+
+    EXPECT_THROW(load_list<int>(truncated), std::runtime_error);
+}
+
+TEST(SnapshotTest, NewerVersionIsRejected) {
+    std::stringstream stream;
+    save_snapshot(stream, make_list(1));
+    std::string bytes = stream.str();
+    SnapshotHeader header{};
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    header.version = SnapshotHeader::current_version + 1;
+    std::memcpy(bytes.data(), &header, sizeof(header));
+    std::stringstream newer(bytes);
+
+    EXPECT_THROW(load_list<int>(newer), std::runtime_error);
+}
+
+TEST(SnapshotTest, FileRoundTrip) {
+    TemporaryFile file;
+    save_snapshot(file.path, make_list(50));
+
+    EXPECT_EQ(load_list<int>(file.path).size(), 50);
+}
+
+TEST(SnapshotTest, MissingFileThrows) {
+    EXPECT_THROW(load_list<int>("/nonexistent/snapshot.bin"), std::runtime_error);
+}
+
+TEST(MappedListTest, MapsList) {
+    TemporaryFile file;
+    const List<int> list = make_list(10'000);
+    save_snapshot(file.path, list);
+
+    const MappedList<int> mapped(file.path);
+
+    ASSERT_EQ(mapped.size(), list.size());
+    EXPECT_EQ(mapped[1234], list[1234]);
+    EXPECT_EQ(mapped.front(), list.front());
+    EXPECT_EQ(mapped.back(), list.back());
+    EXPECT_TRUE(std::equal(list.begin(), list.end(), mapped.begin()));
+    EXPECT_EQ(std::accumulate(mapped.begin(), mapped.end(), 0LL), std::accumulate(list.begin(), list.end(), 0LL));
+}
+
+TEST(MappedListTest, ElementsAreAligned) {
+    TemporaryFile file;
+    save_snapshot(file.path, make_list(3));
+
+    const MappedList<int> mapped(file.path);
+
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(mapped.data()) % SnapshotHeader::data_alignment, 0);
+}
+
+TEST(MappedListTest, MapsArrayAndHeap) {
+    TemporaryFile array_file;
+    save_snapshot(array_file.path, Array<int, 3>{1, 2, 3});
+    EXPECT_EQ(MappedList<int>(array_file.path).size(), 3);
+
+    TemporaryFile heap_file;
+    Heap<int> heap;
+    heap.push(2);
+    heap.push(1);
+    save_snapshot(heap_file.path, heap);
+    EXPECT_EQ(MappedList<int>(heap_file.path).front(), 1);
+}
+
+TEST(MappedListTest, At) {
+    TemporaryFile file;
+    save_snapshot(file.path, make_list(3));
+
+    const MappedList<int> mapped(file.path);
+
+    EXPECT_EQ(mapped.at(2), 11);
+    EXPECT_THROW(mapped.at(3), std::out_of_range);
+}
+
+TEST(MappedListTest, EmptyListHasNoEnds) {
+    TemporaryFile file;
+    save_snapshot(file.path, List<int>());
+
+    const MappedList<int> mapped(file.path);
+
+    EXPECT_TRUE(mapped.is_empty());
+    EXPECT_THROW(mapped.front(), std::out_of_range);
+    EXPECT_THROW(mapped.back(), std::out_of_range);
+    EXPECT_THROW(MappedList<int>().back(), std::out_of_range);
+}
+
+TEST(MappedListTest, Move) {
+    TemporaryFile file;
+    save_snapshot(file.path, make_list(3));
+
+    MappedList<int> mapped(file.path);
+    MappedList<int> moved(std::move(mapped));
+
+    EXPECT_EQ(moved.size(), 3);
+    EXPECT_TRUE(mapped.is_empty());
+
+    mapped = std::move(moved);
+    EXPECT_EQ(mapped.size(), 3);
+    EXPECT_TRUE(moved.is_empty());
+}
+
+TEST(MappedListTest, RejectsInvalidFiles) {
+    EXPECT_THROW(MappedList<int>("/nonexistent/snapshot.bin"), std::system_error);
+
+    TemporaryFile file;
+    save_snapshot(file.path, make_list(3));
+    EXPECT_THROW(MappedList<double>(file.path), std::runtime_error);
+
+    std::filesystem::resize_file(file.path, 70);
+    EXPECT_THROW(MappedList<int>(file.path), std::runtime_error);
+
+    std::filesystem::resize_file(file.path, 10);
+    EXPECT_THROW(MappedList<int>(file.path), std::runtime_error);
+}
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+#include "../DataStructure/TopK.h"
+#include "TrackedObject.h"
+
+#include <string>
+#include <vector>
+
+TEST(TopKTest, KeepsTheGreatest) {
+    TopK<int> top(3);
+    for (int i = 0; i < 100; ++i)
+        top.push((i * 37) % 100);
+
+    EXPECT_TRUE(top.isFull());
+    EXPECT_EQ(top.threshold(), 97);
+
+    List<int> kept = top.take();
+    ASSERT_EQ(kept.size(), 3);
+    EXPECT_EQ(kept[0], 99);
+    EXPECT_EQ(kept[1], 98);
+    EXPECT_EQ(kept[2], 97);
+    EXPECT_TRUE(top.isEmpty());
+}
+
+TEST(TopKTest, ComparatorSelectsTheSmallest) {
+    TopK<std::string, std::greater<>> top(2);
+    EXPECT_TRUE(top.push("pear"));
+    EXPECT_TRUE(top.push("apple"));
+    EXPECT_TRUE(top.push("banana"));
+    EXPECT_FALSE(top.push("zucchini"));
+
+    List<std::string> kept = top.take();
+    ASSERT_EQ(kept.size(), 2);
+    EXPECT_EQ(kept[0], "apple");
+    EXPECT_EQ(kept[1], "banana");
+}
+
+TEST(TopKTest, FewerElementsThanK) {
+    TopK<int> top(10);
+    top.push(2);
+    top.push(1);
+
+    EXPECT_FALSE(top.isFull());
+    List<int> kept = top.take();
+    ASSERT_EQ(kept.size(), 2);
+    EXPECT_EQ(kept[0], 2);
+}
+
+TEST(TopKTest, ZeroKeepsNothing) {
+    TopK<int> top(0);
+    EXPECT_FALSE(top.push(1));
+    EXPECT_TRUE(top.isEmpty());
+}
+
+TEST(TopKTest, PushNMatchesPushingOneByOne) {
+    std::vector<int> stream;
+    for (int i = 0; i < 1000; ++i)
+        stream.push_back((i * 7919) % 1000);
+
+    TopK<int> batched(25);
+    TopK<int> single(25);
+    batched.push_n(stream.begin(), stream.size());
+    for (int value: stream)
+        single.push(value);
+
+    List<int> expected = single.take();
+    List<int> kept = batched.take();
+    ASSERT_EQ(kept.size(), 25);
+    for (size_t i = 0; i < kept.size(); ++i) {
+        EXPECT_EQ(kept[i], expected[i]);
+        EXPECT_EQ(kept[i], 999 - static_cast<int>(i));
+    }
+}
+
+TEST(TopKMemoryTest, NoLeaks) {
+    TrackedObject::reset_counters();
+    {
+        auto by_address = [](const TrackedObject &a, const TrackedObject &b) { return &a < &b; };
+        TopK<TrackedObject, decltype(by_address)> top(4, by_address);
+        for (int i = 0; i < 20; ++i)
+            top.push(TrackedObject());
+        top.take();
+    }
+    EXPECT_EQ(TrackedObject::created(), TrackedObject::destroyed());
+}
@@ -6,21 +6,29 @@
 class TrackedObject {
 public:
     TrackedObject() { ++instances_created; }
-    TrackedObject(const TrackedObject&) { ++instances_created; }
+    TrackedObject(const TrackedObject&) { ++instances_created; ++instances_copied; }
+    TrackedObject(TrackedObject&&) noexcept { ++instances_created; ++instances_moved; }
     TrackedObject& operator=(const TrackedObject&) = default;
+    TrackedObject& operator=(TrackedObject&&) noexcept = default;
     ~TrackedObject() { ++instances_destroyed; }
 
     static void reset_counters() {
         instances_created = 0;
         instances_destroyed = 0;
+        instances_copied = 0;
+        instances_moved = 0;
     }
 
     static std::size_t created() { return instances_created; }
     static std::size_t destroyed() { return instances_destroyed; }
+    static std::size_t copied() { return instances_copied; }
+    static std::size_t moved() { return instances_moved; }
 
 private:
     inline static std::size_t instances_created = 0;
     inline static std::size_t instances_destroyed = 0;
+    inline static std::size_t instances_copied = 0;
+    inline static std::size_t instances_moved = 0;
 };
 
-#endif // TRACKED_OBJECT_H
\ No newline at end of file
+#endif // TRACKED_OBJECT_H
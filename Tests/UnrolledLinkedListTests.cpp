@@ -0,0 +1,219 @@
+#include <gtest/gtest.h>
+#include "../DataStructure/UnrolledLinkedList.h"
+#include "../DataStructure/MemoryResource.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+template<typename Type, size_t node_capacity>
+static std::vector<Type> to_vector(const UnrolledLinkedList<Type, node_capacity> &list) {
+    std::vector<Type> values;
+    for (const Type &value: list)
+        values.push_back(value);
+    return values;
+}
+
+TEST(UnrolledLinkedListTest, PushBackAndFront) {
+    UnrolledLinkedList<int, 4> list;
+    for (int i = 1; i <= 10; ++i)
+        list.push_back(i);
+    list.push_front(0);
+    list.push_front(-1);
+
+    EXPECT_EQ(list.size(), 12);
+    EXPECT_EQ(list.front(), -1);
+    EXPECT_EQ(list.back(), 10);
+    EXPECT_EQ(to_vector(list), (std::vector<int>{-1, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10}));
+}
+
+TEST(UnrolledLinkedListTest, EmptyOnConstruction) {
+    UnrolledLinkedList<int> list;
+    EXPECT_TRUE(list.is_empty());
+    EXPECT_EQ(list.size(), 0);
+    EXPECT_TRUE(list.begin() == list.end());
+}
+
+TEST(UnrolledLinkedListTest, PopFrontUntilEmpty) {
+    UnrolledLinkedList<int, 4> list;
+    for (int i = 0; i < 9; ++i)
+        list.push_back(i);
+
+    for (int i = 0; i < 9; ++i) {
+        EXPECT_EQ(list.front(), i);
+        list.pop_front();
+    }
+    EXPECT_TRUE(list.is_empty());
+
+    list.pop_front();
+    list.push_back(42);
+    EXPECT_EQ(list.front(), 42);
+    EXPECT_EQ(list.back(), 42);
+}
+
+TEST(UnrolledLinkedListTest, InsertAtSplitsFullNodes) {
+    UnrolledLinkedList<int, 4> list;
+    for (int i = 0; i < 4; ++i)
+        list.push_back(i * 10);
+
+    auto iterator = list.begin();
+    ++iterator;
+    list.insert_at(iterator, 15);
+    EXPECT_EQ(to_vector(list), (std::vector<int>{0, 10, 15, 20, 30}));
+
+    iterator = list.begin();
+    for (int i = 0; i < 4; ++i)
+        ++iterator;
+    list.insert_at(iterator, 35);
+    EXPECT_EQ(to_vector(list), (std::vector<int>{0, 10, 15, 20, 30, 35}));
+    EXPECT_EQ(list.back(), 35);
+    EXPECT_EQ(list.size(), 6);
+}
+
+TEST(UnrolledLinkedListTest, RemoveMiddleAndTail) {
+    UnrolledLinkedList<int, 4> list;
+    list.push_back(1);
+    list.push_back(2);
+    list.push_back(3);
+
+    list.remove(++list.begin());
+    EXPECT_EQ(list.size(), 2);
+    EXPECT_EQ(list.back(), 3);
+
+    list.remove(++list.begin());
+    EXPECT_EQ(list.back(), 1);
+    list.push_back(4);
+    EXPECT_EQ(list.back(), 4);
+}
+
+TEST(UnrolledLinkedListTest, RemovingTheLastNodeEmptiesTheTail) {
+    UnrolledLinkedList<int, 2> list;
+    for (int i = 0; i < 5; ++i)
+        list.push_back(i);
+
+    auto last = list.begin();
+    for (int i = 0; i < 4; ++i)
+        ++last;
+    list.remove(last);
+
+    EXPECT_EQ(list.back(), 3);
+    list.push_back(5);
+    EXPECT_EQ(to_vector(list), (std::vector<int>{0, 1, 2, 3, 5}));
+}
+
+TEST(UnrolledLinkedListTest, RemovingFromTheBackUntilEmpty) {
+    UnrolledLinkedList<int, 2> list;
+    for (int i = 0; i < 4; ++i)
+        list.push_back(i);
+    list.push_front(-1);
+    list.insert_at(list.begin(), 10);
+    list.insert_at(++list.begin(), 11);
+
+    std::vector<int> expected = to_vector(list);
+    while (!expected.empty()) {
+        auto last = list.begin();
+        for (size_t i = 1; i < expected.size(); ++i)
+            ++last;
+        list.remove(last);
+        expected.pop_back();
+
+        ASSERT_EQ(to_vector(list), expected);
+        if (!expected.empty()) {
+            ASSERT_EQ(list.back(), expected.back());
+        }
+    }
+    EXPECT_TRUE(list.is_empty());
+
+    list.push_back(7);
+    EXPECT_EQ(list.front(), 7);
+    EXPECT_EQ(list.back(), 7);
+}
+
+TEST(UnrolledLinkedListTest, MatchesVectorUnderRandomOperations) {
+    UnrolledLinkedList<int, 8> list;
+    std::vector<int> expected;
+    std::mt19937 engine(7);
+
+    for (int step = 0; step < 5000; ++step) {
+        const auto operation = engine() % 5;
+        if (operation == 0) {
+            list.push_front(step);
+            expected.insert(expected.begin(), step);
+        } else if (operation == 1) {
+            list.push_back(step);
+            expected.push_back(step);
+        } else if (expected.empty()) {
+            continue;
+        } else if (operation == 2) {
+            const size_t position = engine() % expected.size();
+            auto iterator = list.begin();
+            for (size_t i = 0; i < position; ++i)
+                ++iterator;
+            list.insert_at(iterator, step);
+            expected.insert(expected.begin() + position + 1, step);
+        } else if (operation == 3) {
+            const size_t position = engine() % expected.size();
+            auto iterator = list.begin();
+            for (size_t i = 0; i < position; ++i)
+                ++iterator;
+            list.remove(iterator);
+            expected.erase(expected.begin() + position);
+        } else {
+            list.pop_front();
+            expected.erase(expected.begin());
+        }
+
+        ASSERT_EQ(list.size(), expected.size());
+        if (!expected.empty()) {
+            ASSERT_EQ(list.front(), expected.front());
+            ASSERT_EQ(list.back(), expected.back());
+        }
+    }
+    EXPECT_EQ(to_vector(list), expected);
+}
+
+TEST(UnrolledLinkedListTest, ConstIteratorTraversal) {
+    UnrolledLinkedList<std::string, 2> list;
+    list.push_back("five");
+    list.push_back("ten");
+    list.push_back("fifteen");
+
+    const auto &const_list = list;
+    EXPECT_EQ(to_vector(const_list), (std::vector<std::string>{"five", "ten", "fifteen"}));
+    EXPECT_EQ(const_list.begin()->size(), 4);
+}
+
+TEST(UnrolledLinkedListAllocatorTest, MoveAssignmentTakesTheNodes) {
+    PoolResource pool(64);
+    using PmrList = UnrolledLinkedList<int, 8, std::pmr::polymorphic_allocator<int>>;
+    PmrList source(&pool);
+    for (int i = 0; i < 20; ++i)
+        source.push_back(i);
+    const int *first = &source.front();
+
+    PmrList target(&pool);
+    target.push_back(100);
+    target = std::move(source);
+
+    EXPECT_TRUE(source.is_empty());
+    EXPECT_EQ(target.size(), 20);
+    EXPECT_EQ(&target.front(), first);
+    EXPECT_EQ(target.get_allocator().resource(), &pool);
+}
+
+TEST(UnrolledLinkedListAllocatorTest, MoveAssignmentAcrossResourcesCopies) {
+    MonotonicArena first_arena;
+    MonotonicArena second_arena;
+    using PmrList = UnrolledLinkedList<int, 8, std::pmr::polymorphic_allocator<int>>;
+    PmrList source(&first_arena);
+    for (int i = 0; i < 20; ++i)
+        source.push_back(i);
+
+    PmrList target(&second_arena);
+    target = std::move(source);
+
+    EXPECT_TRUE(source.is_empty());
+    EXPECT_EQ(target.size(), 20);
+    EXPECT_EQ(target.back(), 19);
+    EXPECT_EQ(target.get_allocator().resource(), &second_arena);
+}